@@ -1,5 +1,7 @@
 #pragma once
 #include "moveGen.h"
+#include "perft.h"
+#include "perftTable.h"
 #include "position.h"
 #include <deque>
 #include <memory>
@@ -27,12 +29,20 @@ public:
 
   void makeMove(Move move);
   void undoMove();
-  std::uint64_t runPerft(int depth);
-  void initFen(const std::string &fen);
+  /// @brief Runs perft, hashMB > 0 caches subtree counts in a table of that
+  /// size which is kept between runs
+  std::uint64_t
+  runPerft(int depth, int threads = 1, std::size_t hashMB = 0,
+           Perft::PositionMode mode = Perft::PositionMode::MAKE_UNMAKE);
+  std::uint64_t
+  runBench(Perft::PositionMode mode = Perft::PositionMode::MAKE_UNMAKE);
+  /// @brief Sets up the fen, an invalid fen keeps the current position
+  bool initFen(const std::string &fen);
   void printPieces() const;
   void printMoves() const;
 
 private:
   Position m_pos;
   historyListPtr_t m_historyList;
+  std::unique_ptr<PerftTable> m_perftTable;
 };
\ No newline at end of file
@@ -17,7 +17,8 @@ public:
   void runInterface();
 
 private:
-  void receiveInput();
+  /// @brief Runs one command, returns false on quit or at the end of input
+  bool receiveInput();
   Engine m_engine;
   EngineMode m_mode;
 };
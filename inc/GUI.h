@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <x86intrin.h>
 
 #include "bitboardUtil.h"
@@ -16,10 +17,20 @@ void print_bit_board(bitboard_t b);
  * @param square position info
  */
 void print_pieces(const Position &pos);
-/** Prints the fen for the position
- * @param square position info
+/** Returns the fen for the position, clocks included
+ * @param pos position info
  */
-void getPositionFen(const Position &pos);
+std::string getPositionFen(const Position &pos);
+/// @brief The start position, kiwipete, a middle game and an endgame, parsed
+/// by the fen and the packed position benches alike
+inline constexpr std::string_view BENCH_FENS[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "r2q1rk1/pp2bppp/2n1bn2/3p4/3P4/2NBBN2/PP3PPP/R2Q1RK1 w - - 0 11",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"};
+
+/// @brief Times fen parsing and writing on one thread
+void benchFen();
 /** Helper function to printpieces
  * @param square position info
  * @param pBoard array to store fen representation of the pieces
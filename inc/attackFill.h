@@ -0,0 +1,48 @@
+#pragma once
+#include "types.h"
+
+#include <string_view>
+
+/// @brief Kogge-Stone occluded fills that compute the attacks of a whole set
+/// of sliders at once. The eight ray directions are independent, the SIMD
+/// kernels fill them side by side (four per AVX2 register, all eight in one
+/// AVX-512 register) while the scalar kernel runs them one after the other.
+namespace FILL {
+
+enum class Kernel : std::uint8_t
+{
+  SCALAR,
+  AVX2,
+  AVX512
+};
+
+/// @brief Attacks split by ray kind, so callers can match them against
+/// rooks and bishops
+struct SliderMaps
+{
+  bitboard_t orthogonal;
+  bitboard_t diagonal;
+
+  bitboard_t all() const { return orthogonal | diagonal; }
+};
+
+bool isSupported(Kernel kernel);
+/// @brief The active kernel, the fastest one the CPU supports unless
+/// overridden
+Kernel kernel();
+bool setKernel(Kernel kernel);
+std::string_view kernelName(Kernel kernel);
+
+/// @brief Squares attacked by the orthogonal sliders along ranks and files and
+/// by the diagonal sliders along diagonals, given the occupancy. Dispatches to
+/// the active kernel.
+SliderMaps sliderAttacks(bitboard_t orthogonal, bitboard_t diagonal,
+                         bitboard_t occupancy);
+SliderMaps sliderAttacks(Kernel kernel, bitboard_t orthogonal,
+                         bitboard_t diagonal, bitboard_t occupancy);
+
+/// @brief Times whole side attack maps built with every supported kernel
+/// against the one slider at a time lookup loop
+void bench();
+
+} // namespace FILL
@@ -2,9 +2,8 @@
 #include "bitboardUtil.h"
 #include "types.h"
 
-namespace ATTACKS {
-void init();
-}
+#include <array>
+#include <cstdint>
 
 namespace PEXT_ATTACK {
 
@@ -12,7 +11,7 @@ namespace PEXT_ATTACK {
 struct Magic
 {
   bitboard_t relBits;
-  bitboard_t *attacks;
+  const bitboard_t *attacks;
 
   int index(bitboard_t occupancy) const
   {
@@ -25,6 +24,24 @@ struct Magic
   }
 };
 
-extern Magic ATTACK_MAGICS[SQ_COUNT][2];
+// Same index as Magic, but every attack set is stored as the pext of the
+// empty board attacks and expanded again with pdep. The tables are a quarter
+// of the size at the cost of one pdep per lookup.
+struct CompressedMagic
+{
+  bitboard_t relBits;
+  bitboard_t attackMask;
+  const std::uint16_t *attacks;
+
+  bitboard_t attackBB(bitboard_t occupancy) const
+  {
+    return BitboardUtil::pdep(attacks[BitboardUtil::pext(occupancy, relBits)],
+                              attackMask);
+  }
+};
+
+extern const std::array<std::array<Magic, 2>, SQ_COUNT> ATTACK_MAGICS;
+extern const std::array<std::array<CompressedMagic, 2>, SQ_COUNT>
+    COMPRESSED_MAGICS;
 
 } // namespace PEXT_ATTACK
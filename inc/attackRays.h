@@ -1,1552 +1,101 @@
 #pragma once
+#include "bitboardUtil.h"
 #include "types.h"
 
+#include <array>
+#include <cstdint>
+
+/// @brief Lines through pairs of squares. Instead of a full 64x64 table of
+/// lines the squares are mapped to the kind of line they share (4 KB) and the
+/// line is looked up per kind and square (2.5 KB), which keeps the pin rays
+/// out of the way of the search tables in the cache.
 namespace RayConstants {
-constexpr bitboard_t RayBB[SQ_COUNT][SQ_COUNT] = {
-    {
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x0101010101010101UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL,
-    },
-    {
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x0000000000000102UL,
-        0x0202020202020202UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0202020202020202UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0202020202020202UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x0000000000000000UL,
-        0x0000000000010204UL, 0x0404040404040404UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000010204UL, 0x0000000000000000UL,
-        0x0404040404040404UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0404040404040404UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000001020408UL, 0x0808080808080808UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000001020408UL,
-        0x0000000000000000UL, 0x0808080808080808UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000001020408UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0808080808080808UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000102040810UL,
-        0x1010101010101010UL, 0x0000000080402010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000102040810UL, 0x0000000000000000UL, 0x1010101010101010UL,
-        0x0000000000000000UL, 0x0000000080402010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000102040810UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000080402010UL, 0x0000000102040810UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x1010101010101010UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000010204081020UL, 0x2020202020202020UL, 0x0000000000804020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000010204081020UL, 0x0000000000000000UL,
-        0x2020202020202020UL, 0x0000000000000000UL, 0x0000000000804020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000010204081020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000010204081020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000010204081020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x2020202020202020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0001020408102040UL, 0x4040404040404040UL,
-        0x0000000000008040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0001020408102040UL,
-        0x0000000000000000UL, 0x4040404040404040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0001020408102040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0001020408102040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x4040404040404040UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x00000000000000ffUL,
-        0x00000000000000ffUL, 0x00000000000000ffUL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL,
-    },
-    {
-        0x0101010101010101UL, 0x0000000000000102UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x0101010101010101UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x8040201008040201UL, 0x0202020202020202UL, 0x0000000000010204UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x0000000000010204UL, 0x0202020202020202UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0202020202020202UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL,
-    },
-    {
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0404040404040404UL,
-        0x0000000001020408UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x0000000000000000UL, 0x0000000001020408UL,
-        0x0404040404040404UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000001020408UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0404040404040404UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0808080808080808UL, 0x0000000102040810UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000102040810UL, 0x0808080808080808UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000102040810UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000102040810UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0808080808080808UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x1010101010101010UL, 0x0000010204081020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000010204081020UL, 0x1010101010101010UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000010204081020UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000010204081020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000010204081020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x1010101010101010UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000080402010UL, 0x2020202020202020UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0001020408102040UL,
-        0x2020202020202020UL, 0x0000000080402010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000080402010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0001020408102040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0001020408102040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x2020202020202020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000804020UL,
-        0x4040404040404040UL, 0x0102040810204080UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x4040404040404040UL, 0x0000000000804020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x4040404040404040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000008040UL, 0x8080808080808080UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x000000000000ff00UL, 0x000000000000ff00UL,
-        0x000000000000ff00UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0204081020408000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0204081020408000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0204081020408000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0204081020408000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL,
-    },
-    {
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000010204UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000010204UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0101010101010101UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000001020408UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0202020202020202UL, 0x0000000001020408UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000001020408UL, 0x0202020202020202UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0202020202020202UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000102040810UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0404040404040404UL, 0x0000000102040810UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000000000UL, 0x0000000102040810UL, 0x0404040404040404UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000102040810UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0404040404040404UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL,
-    },
-    {
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000010204081020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0808080808080808UL,
-        0x0000010204081020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000010204081020UL,
-        0x0808080808080808UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000010204081020UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000010204081020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0808080808080808UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x1010101010101010UL, 0x0001020408102040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x1010101010101010UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0001020408102040UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0001020408102040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x1010101010101010UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x2020202020202020UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x2020202020202020UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x2020202020202020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000080402010UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000080402010UL, 0x4040404040404040UL,
-        0x0204081020408000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0204081020408000UL,
-        0x4040404040404040UL, 0x0000000080402010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0204081020408000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x4040404040404040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0204081020408000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000804020UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000804020UL,
-        0x8080808080808080UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000ff0000UL, 0x0000000000ff0000UL, 0x0000000000ff0000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0408102040800000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0408102040800000UL, 0x0000000000000000UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0408102040800000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0408102040800000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0408102040800000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL,
-    },
-    {
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000001020408UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000001020408UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0000000001020408UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x0101010101010101UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000102040810UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000102040810UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0202020202020202UL,
-        0x0000000102040810UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x0000000102040810UL,
-        0x0202020202020202UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0202020202020202UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000010204081020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000010204081020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0404040404040404UL, 0x0000010204081020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x0000000000000000UL,
-        0x0000010204081020UL, 0x0404040404040404UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000010204081020UL, 0x0000000000000000UL,
-        0x0404040404040404UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0001020408102040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0808080808080808UL, 0x0001020408102040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0001020408102040UL, 0x0808080808080808UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0001020408102040UL,
-        0x0000000000000000UL, 0x0808080808080808UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL,
-    },
-    {
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x1010101010101010UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x1010101010101010UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x1010101010101010UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x2020202020202020UL, 0x0204081020408000UL, 0x0000000000000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x2020202020202020UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0204081020408000UL, 0x0000000000000000UL,
-        0x2020202020202020UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0204081020408000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x4040404040404040UL, 0x0408102040800000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0408102040800000UL, 0x4040404040404040UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0408102040800000UL,
-        0x0000000000000000UL, 0x4040404040404040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0408102040800000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0408102040800000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000080402010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000080402010UL, 0x0000000000000000UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000080402010UL, 0x8080808080808080UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x00000000ff000000UL,
-        0x00000000ff000000UL, 0x00000000ff000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0810204080000000UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0810204080000000UL, 0x0000000000000000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0810204080000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0810204080000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL,
-    },
-    {
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000102040810UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000102040810UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0000000000000000UL,
-        0x0000000102040810UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0000000102040810UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x0101010101010101UL, 0x0804020100000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0804020100000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0804020100000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000010204081020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000010204081020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0202020202020202UL,
-        0x0000000000000000UL, 0x0000010204081020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0202020202020202UL, 0x0000010204081020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x0000010204081020UL, 0x0202020202020202UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0001020408102040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0404040404040404UL, 0x0000000000000000UL, 0x0001020408102040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0404040404040404UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x0000000000000000UL, 0x0001020408102040UL,
-        0x0404040404040404UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0808080808080808UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0808080808080808UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x0808080808080808UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x1010101010101010UL,
-        0x0000000000000000UL, 0x0204081020408000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x1010101010101010UL, 0x0204081020408000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0204081020408000UL, 0x1010101010101010UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0204081020408000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL,
-    },
-    {
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x2020202020202020UL, 0x0000000000000000UL, 0x0408102040800000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x2020202020202020UL,
-        0x0408102040800000UL, 0x0000000000000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0408102040800000UL,
-        0x2020202020202020UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0408102040800000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0408102040800000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x4040404040404040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x4040404040404040UL, 0x0810204080000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0810204080000000UL, 0x4040404040404040UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0810204080000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0810204080000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x0000000000000000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000008040201008UL, 0x8080808080808080UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x000000ff00000000UL, 0x000000ff00000000UL,
-        0x000000ff00000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1020408000000000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x1020408000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1020408000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL,
-    },
-    {
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000010204081020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000010204081020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000010204081020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000010204081020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000010204081020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0101010101010101UL, 0x0402010000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0402010000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0001020408102040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0202020202020202UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0001020408102040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0804020100000000UL,
-        0x0202020202020202UL, 0x0001020408102040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0001020408102040UL, 0x0202020202020202UL, 0x0804020100000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0804020100000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0404040404040404UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0404040404040404UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0404040404040404UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0808080808080808UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0204081020408000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0204081020408000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0808080808080808UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0204081020408000UL,
-        0x0808080808080808UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x1010101010101010UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0408102040800000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0408102040800000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x1010101010101010UL, 0x0408102040800000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0408102040800000UL, 0x1010101010101010UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0408102040800000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x2020202020202020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0810204080000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x2020202020202020UL, 0x0810204080000000UL,
-        0x0000000000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0810204080000000UL, 0x2020202020202020UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0810204080000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x8040201008040201UL,
-    },
-    {
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x4040404040404040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x4040404040404040UL,
-        0x1020408000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x1020408000000000UL,
-        0x4040404040404040UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1020408000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000804020100804UL,
-        0x8080808080808080UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000ff0000000000UL, 0x0000ff0000000000UL, 0x0000ff0000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x2040800000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2040800000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL,
-    },
-    {
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0001020408102040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0001020408102040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0001020408102040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0001020408102040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0001020408102040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x0101010101010101UL,
-        0x0201000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0202020202020202UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0402010000000000UL, 0x0202020202020202UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x0102040810204080UL,
-        0x0202020202020202UL, 0x0402010000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0404040404040404UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0204081020408000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0204081020408000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0804020100000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0804020100000000UL,
-        0x0404040404040404UL, 0x0204081020408000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0404040404040404UL, 0x0804020100000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0808080808080808UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0408102040800000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0408102040800000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0408102040800000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0808080808080808UL, 0x0408102040800000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0408102040800000UL, 0x0808080808080808UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x1010101010101010UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0810204080000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0810204080000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x1010101010101010UL,
-        0x0810204080000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0810204080000000UL,
-        0x1010101010101010UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x2020202020202020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x1020408000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x2020202020202020UL, 0x1020408000000000UL, 0x0000000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1020408000000000UL, 0x2020202020202020UL, 0x4020100804020100UL,
-        0x0000000000000000UL,
-    },
-    {
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x4040404040404040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x4040404040404040UL, 0x2040800000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2040800000000000UL, 0x4040404040404040UL,
-        0x8040201008040201UL,
-    },
-    {
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x0000000000000000UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0080402010080402UL, 0x8080808080808080UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x00ff000000000000UL,
-        0x00ff000000000000UL, 0x00ff000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4080000000000000UL,
-        0x8080808080808080UL,
-    },
-    {
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0101010101010101UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0102040810204080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0101010101010101UL, 0x0000000000000000UL,
-        0x0102040810204080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0101010101010101UL, 0x0102040810204080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0202020202020202UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0204081020408000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0202020202020202UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0204081020408000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0202020202020202UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0204081020408000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0202020202020202UL,
-        0x0000000000000000UL, 0x0204081020408000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0201000000000000UL, 0x0202020202020202UL, 0x0204081020408000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0404040404040404UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0408102040800000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0404040404040404UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0408102040800000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0404040404040404UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0408102040800000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0402010000000000UL, 0x0000000000000000UL,
-        0x0404040404040404UL, 0x0000000000000000UL, 0x0408102040800000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0402010000000000UL, 0x0404040404040404UL,
-        0x0408102040800000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0808080808080808UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0808080808080808UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0810204080000000UL, 0x0804020100000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0808080808080808UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0810204080000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0804020100000000UL,
-        0x0000000000000000UL, 0x0808080808080808UL, 0x0000000000000000UL,
-        0x0810204080000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0804020100000000UL,
-        0x0808080808080808UL, 0x0810204080000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x1010101010101010UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x1010101010101010UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1010101010101010UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1020408000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x0000000000000000UL, 0x1010101010101010UL,
-        0x0000000000000000UL, 0x1020408000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x1008040201000000UL, 0x1010101010101010UL, 0x1020408000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x2020202020202020UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x2020202020202020UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2020202020202020UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x0000000000000000UL,
-        0x2020202020202020UL, 0x0000000000000000UL, 0x2040800000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x2010080402010000UL, 0x2020202020202020UL,
-        0x2040800000000000UL, 0x0000000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL,
-    },
-    {
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x4040404040404040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x4040404040404040UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4040404040404040UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x0000000000000000UL, 0x4040404040404040UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x4020100804020100UL,
-        0x4040404040404040UL, 0x4080000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL,
-    },
-    {
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x8080808080808080UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8080808080808080UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x0000000000000000UL, 0x8080808080808080UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x0000000000000000UL, 0x0000000000000000UL, 0x0000000000000000UL,
-        0x8040201008040201UL, 0x8080808080808080UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL, 0xff00000000000000UL, 0xff00000000000000UL,
-        0xff00000000000000UL,
-    },
+
+enum LineKind : std::uint8_t
+{
+  NO_LINE,
+  RANK,
+  FILE,
+  DIAGONAL,      // a8 to h1 direction
+  ANTI_DIAGONAL, // h8 to a1 direction
+  LINE_KINDS
 };
 
+constexpr int rowOf(const int square) { return square >> 3; }
+constexpr int colOf(const int square) { return square & 7; }
+
+constexpr LineKind lineKind(const int sq1, const int sq2)
+{
+  if (sq1 == sq2)
+  {
+    return NO_LINE;
+  }
+  if (rowOf(sq1) == rowOf(sq2))
+  {
+    return RANK;
+  }
+  if (colOf(sq1) == colOf(sq2))
+  {
+    return FILE;
+  }
+  if (rowOf(sq1) - colOf(sq1) == rowOf(sq2) - colOf(sq2))
+  {
+    return DIAGONAL;
+  }
+  if (rowOf(sq1) + colOf(sq1) == rowOf(sq2) + colOf(sq2))
+  {
+    return ANTI_DIAGONAL;
+  }
+  return NO_LINE;
+}
+
+constexpr auto makeLineKinds()
+{
+  std::array<std::array<LineKind, SQ_COUNT>, SQ_COUNT> kinds{};
+  for (int sq1 = 0; sq1 < SQ_COUNT; sq1++)
+  {
+    for (int sq2 = 0; sq2 < SQ_COUNT; sq2++)
+    {
+      kinds[sq1][sq2] = lineKind(sq1, sq2);
+    }
+  }
+  return kinds;
+}
+
+constexpr auto makeLines()
+{
+  std::array<std::array<bitboard_t, SQ_COUNT>, LINE_KINDS> lines{};
+  for (int square = 0; square < SQ_COUNT; square++)
+  {
+    for (int other = 0; other < SQ_COUNT; other++)
+    {
+      const LineKind kind = lineKind(square, other);
+      if (kind != NO_LINE)
+      {
+        lines[kind][square] |= BB(square) | BB(other);
+      }
+    }
+  }
+  return lines;
+}
+
+inline constexpr auto LINE_KIND = makeLineKinds();
+inline constexpr auto LINES = makeLines();
+
+/// @brief The whole line through both squares from edge to edge, empty when
+/// they are not aligned
+inline constexpr bitboard_t lineBB(const square_t sq1, const square_t sq2)
+{
+  return LINES[LINE_KIND[sq1][sq2]][sq1];
+}
+
+/// @brief Squares strictly between two aligned squares, empty otherwise
 inline constexpr bitboard_t betweenBB(square_t sq1, square_t sq2)
 {
   constexpr bitboard_t ALL_SQ = ~0ULL;
   const bitboard_t between =
-      RayBB[sq1][sq2] & ((ALL_SQ << sq1) ^ (ALL_SQ << sq2));
+      lineBB(sq1, sq2) & ((ALL_SQ << sq1) ^ (ALL_SQ << sq2));
   return between & (between - 1); // exclude lsb
 }
 
-} // namespace RayConstants
\ No newline at end of file
+} // namespace RayConstants
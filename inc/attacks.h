@@ -0,0 +1,153 @@
+#pragma once
+#include "attackPextV2.h"
+#include "bitboardUtil.h"
+#include "types.h"
+
+#include <array>
+#include <string_view>
+
+/// @brief The ways slider attacks can be looked up. All of them are compiled
+/// into the binary with their tables generated at compile time, the hot paths
+/// are instantiated once per backend and the fastest one supported by the CPU
+/// is picked at startup.
+enum class SliderBackend : std::uint8_t
+{
+  PEXT,      // BMI2 pext index, fastest where pext is not microcoded
+  PEXT_PDEP, // Pext index into 16 bit attack sets expanded with pdep
+  MAGIC,     // Fancy magic multiplication, any 64 bit CPU
+  PORTABLE   // Ray scan to the first blocker, small tables and no hashing
+};
+
+constexpr SliderBackend SLIDER_BACKENDS[] = {
+    SliderBackend::PEXT, SliderBackend::PEXT_PDEP, SliderBackend::MAGIC,
+    SliderBackend::PORTABLE};
+
+namespace MAGIC_ATTACK {
+
+// Fancy magic lookup for CPUs without a fast pext. The relevant occupancy is
+// hashed into a dense per square index by a multiplication and a shift.
+struct Magic
+{
+  bitboard_t relBits;
+  bitboard_t magic;
+  const bitboard_t *attacks;
+  unsigned shift;
+
+  constexpr unsigned index(bitboard_t occupancy) const
+  {
+    return static_cast<unsigned>(((occupancy & relBits) * magic) >> shift);
+  }
+
+  constexpr bitboard_t attackBB(bitboard_t occupancy) const
+  {
+    return attacks[index(occupancy)];
+  }
+};
+
+extern const std::array<std::array<Magic, 2>, SQ_COUNT> ATTACK_MAGICS;
+
+} // namespace MAGIC_ATTACK
+
+namespace PORTABLE_ATTACK {
+
+// Rays in the increasing square directions come first, the first blocker on
+// those is the lowest set bit and on the others the highest
+constexpr Direction RAY_DIRECTIONS[8] = {EAST, SOUTH, SOUTH_EAST, SOUTH_WEST,
+                                         WEST, NORTH, NORTH_WEST, NORTH_EAST};
+
+extern const std::array<std::array<bitboard_t, SQ_COUNT>, 8> RAYS;
+
+template <int dir>
+inline bitboard_t rayAttack(const bitboard_t occupancy, const square_t square)
+{
+  const bitboard_t ray = RAYS[dir][square];
+  const bitboard_t blockers = ray & occupancy;
+  if (blockers == 0)
+  {
+    return ray;
+  }
+  const square_t blocker = dir < 4 ? BitboardUtil::bitScan(blockers)
+                                   : BitboardUtil::bitScanReverse(blockers);
+  return ray ^ RAYS[dir][blocker];
+}
+
+template <PieceType pt>
+inline bitboard_t attackBB(const bitboard_t occupancy, const square_t square)
+{
+  if constexpr (pt == BISHOP)
+  {
+    return rayAttack<2>(occupancy, square) | rayAttack<3>(occupancy, square) |
+           rayAttack<6>(occupancy, square) | rayAttack<7>(occupancy, square);
+  }
+  else
+  {
+    return rayAttack<0>(occupancy, square) | rayAttack<1>(occupancy, square) |
+           rayAttack<4>(occupancy, square) | rayAttack<5>(occupancy, square);
+  }
+}
+
+} // namespace PORTABLE_ATTACK
+
+namespace ATTACKS {
+bool isSupported(SliderBackend backend);
+/// @brief The fastest supported backend, pext is skipped on AMD Zen1/Zen2
+/// where it is microcoded
+SliderBackend detectBackend();
+SliderBackend backend();
+/// @brief Overrides the active backend, fails if the CPU does not support it
+bool setBackend(SliderBackend backend);
+
+std::string_view backendName(SliderBackend backend);
+bool parseBackend(std::string_view name, SliderBackend &backend);
+
+/// @brief Slider attacks for a fixed backend, used by the hot paths
+template <PieceType pt, SliderBackend b>
+inline bitboard_t sliderAttacks(const bitboard_t occupancy,
+                                const square_t square)
+{
+  static_assert(pt == BISHOP || pt == ROOK || pt == QUEEN,
+                "Unsupported piece type in sliderAttacks()");
+
+  if constexpr (pt == QUEEN)
+  {
+    return sliderAttacks<BISHOP, b>(occupancy, square) |
+           sliderAttacks<ROOK, b>(occupancy, square);
+  }
+  else if constexpr (b == SliderBackend::PEXT)
+  {
+    return PEXT_ATTACK::ATTACK_MAGICS[square][pt - BISHOP].attackBB(occupancy);
+  }
+  else if constexpr (b == SliderBackend::PEXT_PDEP)
+  {
+    return PEXT_ATTACK::COMPRESSED_MAGICS[square][pt - BISHOP].attackBB(
+        occupancy);
+  }
+  else if constexpr (b == SliderBackend::MAGIC)
+  {
+    return MAGIC_ATTACK::ATTACK_MAGICS[square][pt - BISHOP].attackBB(occupancy);
+  }
+  else
+  {
+    return PORTABLE_ATTACK::attackBB<pt>(occupancy, square);
+  }
+}
+
+/// @brief Slider attacks with the active backend
+template <PieceType pt>
+inline bitboard_t sliderAttacks(const bitboard_t occupancy,
+                                const square_t square)
+{
+  switch (backend())
+  {
+  case SliderBackend::PEXT:
+    return sliderAttacks<pt, SliderBackend::PEXT>(occupancy, square);
+  case SliderBackend::PEXT_PDEP:
+    return sliderAttacks<pt, SliderBackend::PEXT_PDEP>(occupancy, square);
+  case SliderBackend::MAGIC:
+    return sliderAttacks<pt, SliderBackend::MAGIC>(occupancy, square);
+  default:
+    return sliderAttacks<pt, SliderBackend::PORTABLE>(occupancy, square);
+  }
+}
+
+} // namespace ATTACKS
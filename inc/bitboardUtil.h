@@ -6,8 +6,11 @@
 
 #include "types.h"
 
-#if __has_builtin(__builtin_ia32_pext_di)
-#define PEXT
+// The pext slider backend is compiled into x86-64 builds and selected at run
+// time when the CPU supports BMI2, build with NO_PEXT to leave it out
+#if (defined(__x86_64__) || __has_builtin(__builtin_ia32_pext_di)) &&         \
+    !defined(NO_PEXT)
+#define PEXT_BACKEND
 #endif
 
 // #define getTo(move) (move & 0xFFU)
@@ -59,7 +62,8 @@ constexpr int CHECK_MATE = -0xFFFF;
 constexpr index_t BLACK = 1;
 constexpr index_t WHITE = 0;
 constexpr int BOARD_DIMMENSION = 8;
-constexpr std::size_t MAX_MOVES = 100;
+// Legal positions have at most 218 moves
+constexpr std::size_t MAX_MOVES = 256;
 
 //---------CASTLING SQUARES--------------------------
 
@@ -188,10 +192,47 @@ template <Direction D> inline constexpr bitboard_t shift(const bitboard_t bb)
 
 inline int pext(bitboard_t BB, bitboard_t mask)
 {
-#ifdef PEXT
+#if __has_builtin(__builtin_ia32_pext_di)
   return static_cast<int>(__builtin_ia32_pext_di(BB, mask));
+#elif defined(PEXT_BACKEND)
+  // Built without BMI2 enabled, only reached once the CPU is known to have it
+  bitboard_t result;
+  __asm__("pextq %2, %1, %0" : "=r"(result) : "r"(BB), "r"(mask));
+  return static_cast<int>(result);
 #else
-  return 0; // Impl needed
+  // Gather the masked bits one at a time, lowest first
+  std::uint64_t result = 0;
+  for (std::uint64_t bit = 1ULL; mask != 0; mask &= mask - 1, bit <<= 1)
+  {
+    if (BB & mask & (~mask + 1))
+    {
+      result |= bit;
+    }
+  }
+  return static_cast<int>(result);
+#endif
+}
+
+inline bitboard_t pdep(bitboard_t BB, bitboard_t mask)
+{
+#if __has_builtin(__builtin_ia32_pdep_di)
+  return __builtin_ia32_pdep_di(BB, mask);
+#elif defined(PEXT_BACKEND)
+  // Built without BMI2 enabled, only reached once the CPU is known to have it
+  bitboard_t result;
+  __asm__("pdepq %2, %1, %0" : "=r"(result) : "r"(BB), "r"(mask));
+  return result;
+#else
+  // Scatter the low bits to the mask bits one at a time, lowest first
+  bitboard_t result = 0;
+  for (bitboard_t bit = 1; mask != 0; mask &= mask - 1, bit <<= 1)
+  {
+    if (BB & bit)
+    {
+      result |= mask & (~mask + 1);
+    }
+  }
+  return result;
 #endif
 }
 
@@ -213,6 +254,20 @@ inline index_t bitScan(bitboard_t BB)
 #endif
 }
 
+inline index_t bitScanReverse(bitboard_t BB)
+{
+#if __has_builtin(__builtin_clzll)
+  return static_cast<index_t>(63 ^ __builtin_clzll(BB));
+#else
+  index_t square = 0;
+  while (BB >>= 1)
+  {
+    square++;
+  }
+  return square;
+#endif
+}
+
 // Squares infront of pawn
 template <bool white> inline bitboard_t forwardSquares(square_t sq)
 {
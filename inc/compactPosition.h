@@ -0,0 +1,310 @@
+#pragma once
+#include "bitboardUtil.h"
+#include "moveGen.h"
+#include "positionAttacks.h"
+#include "types.h"
+#include "zobristHash.h"
+
+#include <array>
+#include <cstdint>
+
+class Position;
+
+/// @brief A position in a single cache line, made for copy-make: a move is
+/// played on a copy of the parent and never taken back. The board is a quad
+/// bitboard, three planes hold a three bit piece code per square and the
+/// fourth holds the black pieces. Bishops and queens share the diagonal plane
+/// and rooks and queens the orthogonal one, so the slider sets movegen asks
+/// for most are a single and-not. Handing a position to another thread is a
+/// plain copy as well.
+class alignas(64) CompactPosition final
+{
+public:
+  static constexpr bool COPY_MAKE = true;
+
+  CompactPosition() = default;
+  /// @brief Packs the board and the current state of a make/unmake position
+  explicit CompactPosition(const Position &pos);
+
+  template <Side s> void doMove(Move move);
+  void doMove(Move move);
+
+  // Same accessors as Position, movegen is written against both
+  template <PieceType... pts> constexpr bitboard_t pieces() const;
+  template <Side s, PieceType... pts> constexpr bitboard_t pieces() const;
+  template <Side s> constexpr bitboard_t pieces_s() const;
+  template <Side s> constexpr square_t kingSquare() const;
+  constexpr PieceType pieceOn(square_t square) const;
+
+  square_t enPassant() const { return m_enPassant; }
+  bitboard_t checkers() const { return m_checkers; }
+  bitboard_t pinnedMask() const { return m_pinnedMask; }
+  bitboard_t blockForKing() const;
+  bitboard_t hashKey() const { return m_hashKey; }
+  bool isWhiteToMove() const { return m_whiteToMove; }
+  template <Side s> constexpr std::uint8_t castleRights() const;
+
+  template <Side s, SliderBackend b>
+  bitboard_t attackedSquares(bitboard_t occupancy) const;
+  template <Side s, SliderBackend b>
+  bool isSpecialEnPassantKingPin(bitboard_t epPawn,
+                                 const BitboardUtil::Masks *masks) const;
+
+private:
+  enum Plane : index_t
+  {
+    DIAGONAL,
+    ORTHOGONAL,
+    LEAPER,
+    BLACK_PIECES,
+    PLANES
+  };
+
+  // Codes by piece type: bishop 1, rook 2, queen 3, pawn 4, knight 5, king 6
+  static constexpr std::array<index_t, KING + 1> CODES = {0, 4, 5, 1, 2, 3, 6};
+  static constexpr std::array<PieceType, 8> TYPES = {
+      NO_PIECE, BISHOP, ROOK, QUEEN, PAWN, KNIGHT, KING, NO_PIECE};
+
+  /// @brief Sets the piece on the given squares, which must be empty
+  template <Side s> void put(PieceType piece, bitboard_t squares);
+  void clear(bitboard_t squares);
+  template <Side s> bool hasPawnsOnEpRank() const;
+
+  std::array<bitboard_t, PLANES> m_planes;
+  bitboard_t m_hashKey;
+  bitboard_t m_checkers;
+  bitboard_t m_pinnedMask;
+  std::array<square_t, NUM_COLORS> m_kings;
+  square_t m_enPassant;
+  std::uint8_t m_castlingRights;
+  bool m_whiteToMove;
+};
+
+static_assert(sizeof(CompactPosition) == 64,
+              "CompactPosition should fill exactly one cache line");
+
+template <PieceType... pts>
+inline constexpr bitboard_t CompactPosition::pieces() const
+{
+  const bitboard_t diagonal = m_planes[DIAGONAL];
+  const bitboard_t orthogonal = m_planes[ORTHOGONAL];
+  const bitboard_t leaper = m_planes[LEAPER];
+  constexpr std::array<PieceType, sizeof...(pts)> types = {pts...};
+
+  // The two slider pairs have a plane of their own
+  if constexpr (types.size() == 2 && types[0] == ROOK && types[1] == QUEEN)
+  {
+    return orthogonal & ~leaper;
+  }
+  else if constexpr (types.size() == 2 && types[0] == BISHOP &&
+                     types[1] == QUEEN)
+  {
+    return diagonal & ~leaper;
+  }
+  else
+  {
+    bitboard_t result = 0;
+    for (const PieceType type : types)
+    {
+      switch (type)
+      {
+      case ALL_PIECES:
+        result |= diagonal | orthogonal | leaper;
+        break;
+      case PAWN:
+        result |= leaper & ~(diagonal | orthogonal);
+        break;
+      case KNIGHT:
+        result |= leaper & diagonal;
+        break;
+      case BISHOP:
+        result |= diagonal & ~(orthogonal | leaper);
+        break;
+      case ROOK:
+        result |= orthogonal & ~(diagonal | leaper);
+        break;
+      case QUEEN:
+        result |= diagonal & orthogonal;
+        break;
+      default: // KING
+        result |= leaper & orthogonal;
+        break;
+      }
+    }
+    return result;
+  }
+}
+
+template <Side s, PieceType... pts>
+inline constexpr bitboard_t CompactPosition::pieces() const
+{
+  return pieces_s<s>() & pieces<pts...>();
+}
+
+template <Side s> inline constexpr bitboard_t CompactPosition::pieces_s() const
+{
+  if constexpr (s == Side::WHITE)
+  {
+    return pieces<ALL_PIECES>() & ~m_planes[BLACK_PIECES];
+  }
+  else
+  {
+    return m_planes[BLACK_PIECES];
+  }
+}
+
+template <Side s>
+inline constexpr square_t CompactPosition::kingSquare() const
+{
+  return m_kings[static_cast<index_t>(s)];
+}
+
+inline constexpr PieceType CompactPosition::pieceOn(const square_t square) const
+{
+  return TYPES[((m_planes[DIAGONAL] >> square) & 1U) |
+               (((m_planes[ORTHOGONAL] >> square) & 1U) << 1U) |
+               (((m_planes[LEAPER] >> square) & 1U) << 2U)];
+}
+
+inline bitboard_t CompactPosition::blockForKing() const
+{
+  return PositionAttacks::blockForKing(m_checkers,
+                                       m_kings[m_whiteToMove ? 0 : 1]);
+}
+
+template <Side s>
+inline constexpr std::uint8_t CompactPosition::castleRights() const
+{
+  return s == Side::WHITE ? m_castlingRights : m_castlingRights >> 2U;
+}
+
+template <Side s, SliderBackend b>
+inline bitboard_t
+CompactPosition::attackedSquares(const bitboard_t occupancy) const
+{
+  return PositionAttacks::attackedSquares<s, b>(*this, occupancy);
+}
+
+template <Side s, SliderBackend b>
+inline bool CompactPosition::isSpecialEnPassantKingPin(
+    const bitboard_t epPawn, const BitboardUtil::Masks *masks) const
+{
+  return PositionAttacks::isSpecialEnPassantKingPin<s, b>(*this, epPawn, masks);
+}
+
+template <Side s>
+inline void CompactPosition::put(const PieceType piece,
+                                 const bitboard_t squares)
+{
+  const index_t code = CODES[piece];
+  for (index_t plane = DIAGONAL; plane <= LEAPER; plane++)
+  {
+    m_planes[plane] |= (bitboard_t{0} - ((code >> plane) & 1U)) & squares;
+  }
+  if constexpr (s == Side::BLACK)
+  {
+    m_planes[BLACK_PIECES] |= squares;
+  }
+}
+
+inline void CompactPosition::clear(const bitboard_t squares)
+{
+  for (auto &plane : m_planes)
+  {
+    plane &= ~squares;
+  }
+}
+
+template <Side s> inline bool CompactPosition::hasPawnsOnEpRank() const
+{
+  return (pieces<s, PAWN>() & BitboardUtil::bitboardMasks<s>()->EP_RANK) != 0;
+}
+
+template <Side s> inline void CompactPosition::doMove(const Move move)
+{
+  constexpr Side enemy = BitboardUtil::opposite<s>();
+  constexpr const BitboardUtil::Masks *masks = BitboardUtil::bitboardMasks<s>();
+
+  const square_t from = move.getFrom();
+  const square_t to = move.getTo();
+  const PieceType mover = pieceOn(from);
+  const PieceType captured = pieceOn(to);
+
+  // Keys of NO_PIECE are zero, a quiet move changes nothing by "capturing"
+  bitboard_t key = m_hashKey ^ Zobrist::KEYS.blackToMove ^
+                   Zobrist::pieceKey<s>(mover, from) ^
+                   Zobrist::pieceKey<enemy>(captured, to);
+  if (m_enPassant != SQ_NONE)
+  {
+    key ^= Zobrist::KEYS.enPassant[BitboardUtil::fileOf(m_enPassant)];
+    m_enPassant = SQ_NONE;
+  }
+
+  clear(BB(from) | BB(to));
+  PieceType placed = mover;
+  switch (move.getFlags())
+  {
+  case NO_FLAG:
+    if (move.isDoubleJump() && hasPawnsOnEpRank<enemy>())
+    {
+      m_enPassant = static_cast<square_t>(to + masks->DOWN);
+      key ^= Zobrist::KEYS.enPassant[BitboardUtil::fileOf(to)];
+    }
+    break;
+  case EN_PASSANT:
+  {
+    const auto pawnSquare = static_cast<square_t>(to + masks->DOWN);
+    clear(BB(pawnSquare));
+    key ^= Zobrist::pieceKey<enemy>(PAWN, pawnSquare);
+    break;
+  }
+  case CASTLE:
+  {
+    const bool kingSide = (BB(to) & masks->CASTLE_KING_PIECES) != 0;
+    const square_t rookFrom = kingSide ? masks->CASTLE_KING_ROOK_SOURCE
+                                       : masks->CASTLE_QUEEN_ROOK_SOURCE;
+    const square_t rookTo = kingSide ? masks->CASTLE_KING_ROOK_DEST
+                                     : masks->CASTLE_QUEEN_ROOK_DEST;
+    clear(BB(rookFrom));
+    put<s>(ROOK, BB(rookTo));
+    key ^= Zobrist::pieceKey<s>(ROOK, rookFrom) ^
+           Zobrist::pieceKey<s>(ROOK, rookTo);
+    break;
+  }
+  default:
+    placed = static_cast<PieceType>(KNIGHT + move.getPromo());
+    break;
+  }
+  put<s>(placed, BB(to));
+  key ^= Zobrist::pieceKey<s>(placed, to);
+
+  if (mover == KING)
+  {
+    m_kings[static_cast<index_t>(s)] = to;
+  }
+
+  key ^= Zobrist::KEYS.castling[m_castlingRights];
+  m_castlingRights &= BitboardUtil::castlingModifiers[from];
+  m_castlingRights &= BitboardUtil::castlingModifiers[to];
+  key ^= Zobrist::KEYS.castling[m_castlingRights];
+
+  m_whiteToMove = !m_whiteToMove;
+  m_hashKey = key;
+
+  const PositionAttacks::CheckInfo info =
+      PositionAttacks::checkInfo<enemy>(*this);
+  m_checkers = info.checkers;
+  m_pinnedMask = info.pinnedMask;
+}
+
+inline void CompactPosition::doMove(const Move move)
+{
+  if (m_whiteToMove)
+  {
+    doMove<Side::WHITE>(move);
+  }
+  else
+  {
+    doMove<Side::BLACK>(move);
+  }
+}
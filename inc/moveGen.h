@@ -4,11 +4,7 @@
 #include "types.h"
 #include <algorithm>
 
-#ifdef PEXT
-#include "attackPextV2.h"
-#else
 #include "attacks.h"
-#endif
 
 #include <array>
 #include <string>
@@ -68,13 +64,27 @@ enum class MoveFilter : std::uint8_t
 };
 
 class Position;
+class CompactPosition;
 
 namespace MoveGen {
-/// @brief Generate the possible moves
+/// @brief Generate the possible moves, with the active slider backend unless
+/// one is given
 template <MoveFilter filter>
 Move *generate(const Position &pos, Move *moveList);
 template <MoveFilter filter, Side s>
 Move *generate(const Position &pos, Move *moveList);
+template <MoveFilter filter, Side s, SliderBackend b>
+Move *generate(const Position &pos, Move *moveList);
+template <MoveFilter filter, Side s, SliderBackend b>
+Move *generate(const CompactPosition &pos, Move *moveList);
+
+/// @brief Count the possible moves without writing them to a move list
+template <MoveFilter filter> std::size_t count(const Position &pos);
+template <MoveFilter filter, Side s> std::size_t count(const Position &pos);
+template <MoveFilter filter, Side s, SliderBackend b>
+std::size_t count(const Position &pos);
+template <MoveFilter filter, Side s, SliderBackend b>
+std::size_t count(const CompactPosition &pos);
 
 /// @brief Gives the attack bitboard for a piece given
 /// the occupancy and start square
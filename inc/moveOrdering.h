@@ -8,4 +8,66 @@ namespace MoveOrder {
 
 // void captureSort(MoveList &move_list);
 // inline bool captureScore(uint32_t move1, uint32_t move2);
+
+constexpr int NUM_KILLERS = 2;
+
+/// @brief Most valuable victim, least valuable attacker score of a capture
+/// or promotion
+score_t mvvLva(const Position &pos, Move move);
 }; // namespace MoveOrder
+
+/// @brief Hands out the legal moves of a position in stages, generating each
+/// stage only when the previous one is exhausted:
+/// hash move, good captures (MVV-LVA, not losing by SEE), killers, quiets,
+/// bad captures.
+/// A cutoff on an early move skips the generation of the later stages.
+class MovePicker final
+{
+public:
+  explicit MovePicker(const Position &pos, Move ttMove = Move(),
+                      const Move *killers = nullptr);
+  MovePicker(const MovePicker &) = delete;
+  MovePicker &operator=(const MovePicker &) = delete;
+
+  /// @brief Returns the next move, or Move() when all moves are handed out
+  Move next();
+
+private:
+  enum class Stage : std::uint8_t
+  {
+    TT_MOVE,
+    GEN_CAPTURES,
+    GOOD_CAPTURES,
+    KILLERS,
+    GEN_QUIETS,
+    QUIETS,
+    BAD_CAPTURES,
+    DONE
+  };
+
+  struct ScoredMove
+  {
+    Move move;
+    score_t score;
+  };
+
+  bool isCaptureStage(Move move) const;
+  bool isGoodCapture(Move move) const;
+  bool isValid(Move move) const;
+  bool isSpecial(Move move) const;
+  void generateCaptures();
+  void generateQuiets();
+  static ScoredMove *pickBest(ScoredMove *begin, ScoredMove *end);
+
+  const Position &m_pos;
+  Stage m_stage;
+  Move m_ttMove;
+  Move m_killers[MoveOrder::NUM_KILLERS];
+  index_t m_killerIndex = 0;
+
+  // Bad captures are moved to the front of the buffer as they are found
+  ScoredMove m_moves[BitboardUtil::MAX_MOVES];
+  ScoredMove *m_cur = m_moves;
+  ScoredMove *m_end = m_moves;
+  ScoredMove *m_endBadCaptures = m_moves;
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include "bitboardUtil.h"
+#include "moveGen.h"
+#include "types.h"
+
+#include <string_view>
+
+/// @brief Writes target bitboards into move lists. The AVX-512 kernel builds
+/// the moves to all 64 squares in two registers and compresses the ones in the
+/// target mask, without a branch per move. Short target sets stay on the
+/// scalar bit by bit loop of the emitters. The kernel stores whole registers,
+/// so move lists need 32 free slots behind their last move, which MAX_MOVES
+/// leaves.
+namespace SERIALIZE {
+
+enum class Kernel : std::uint8_t
+{
+  SCALAR,
+  AVX512
+};
+
+bool isSupported(Kernel kernel);
+/// @brief The active kernel, AVX-512 when the CPU supports it unless
+/// overridden
+Kernel kernel();
+bool setKernel(Kernel kernel);
+std::string_view kernelName(Kernel kernel);
+
+// Set while the AVX-512 kernel is active, read by the emitters on every call
+extern bool VectorActive;
+
+/// @brief Fewer targets than this are cheaper to serialize one at a time
+constexpr index_t VECTOR_MIN_TARGETS = 6;
+
+inline bool useVector(const bitboard_t targets)
+{
+  return VectorActive && BitboardUtil::bitCount(targets) >= VECTOR_MIN_TARGETS;
+}
+
+#if defined(__x86_64__)
+// The AVX-512 kernel, only called when useVector() holds
+
+/// @brief Adds base | to for every target, base holds the from square and
+/// the flags
+Move *fromSquare(Move *moveList, move_t base, bitboard_t targets);
+
+/// @brief Adds a move from to - step to every target with the given flags
+Move *pawnMoves(Move *moveList, int step, move_t flags, bitboard_t targets);
+#endif
+
+/// @brief Times move generation with every supported kernel
+void bench();
+
+} // namespace SERIALIZE
@@ -0,0 +1,60 @@
+#pragma once
+#include "bitboardUtil.h"
+#include "moveGen.h"
+#include "position.h"
+#include "types.h"
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+
+/// @brief Per thread stack of the moves and states of every ply of a tree
+/// walk. A ply takes exactly the move slots it generated, right after the ones
+/// of the ply below, so deep walks stay in a small dense block of memory
+/// instead of a full move array per recursion frame. Every thread owns one.
+class MoveStack final
+{
+public:
+  static constexpr std::size_t MAX_PLY = 128;
+
+  /// @brief The moves generated at one ply and the state of the move played
+  /// from it
+  struct Frame
+  {
+    Move *begin;
+    Move *end;
+    StateInfo state;
+  };
+
+  MoveStack()
+      : m_moves(std::make_unique<Move[]>(MAX_PLY * BitboardUtil::MAX_MOVES)),
+        m_frames(std::make_unique<Frame[]>(MAX_PLY)), m_top(m_moves.get()),
+        m_ply(0)
+  {}
+  MoveStack(const MoveStack &) = delete;
+  MoveStack &operator=(const MoveStack &) = delete;
+
+  /// @brief Generates the moves of the next ply on top of the stack. The
+  /// state of the frame is left alone, copy-make positions do not use it.
+  template <MoveFilter filter, Side s, SliderBackend b, class Pos>
+  Frame &push(const Pos &pos)
+  {
+    assert(m_ply < MAX_PLY);
+    Frame &frame = m_frames[m_ply++];
+    frame.begin = m_top;
+    frame.end = MoveGen::generate<filter, s, b>(pos, m_top);
+    m_top = frame.end;
+    return frame;
+  }
+
+  /// @brief Releases the move slots of the top ply
+  void pop() { m_top = m_frames[--m_ply].begin; }
+
+  std::size_t ply() const { return m_ply; }
+
+private:
+  std::unique_ptr<Move[]> m_moves;
+  std::unique_ptr<Frame[]> m_frames;
+  Move *m_top;
+  std::size_t m_ply;
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include "position.h"
+
+#include <cstddef>
+#include <fstream>
+#include <span>
+#include <string>
+
+/// @brief Bulk storage of positions as PackedPosition records. A file is the
+/// records back to back with nothing in between, so a block of them is read
+/// straight into memory and decoded without any parsing. The multi byte
+/// fields are little endian, big endian hosts swap them on the way.
+namespace PACKED {
+
+class Reader final
+{
+public:
+  explicit Reader(const std::string &path);
+
+  bool isOpen() const { return m_file.is_open(); }
+  /// @brief Reads up to records.size() records, returns how many were read.
+  /// A truncated record at the end of the file is not counted.
+  std::size_t read(std::span<PackedPosition> records);
+
+private:
+  std::ifstream m_file;
+};
+
+class Writer final
+{
+public:
+  explicit Writer(const std::string &path);
+
+  bool isOpen() const { return m_file.is_open(); }
+  bool write(std::span<const PackedPosition> records);
+  bool write(const Position &pos);
+
+private:
+  std::ofstream m_file;
+};
+
+/// @brief Times loading positions from fens against packed records
+void bench();
+
+} // namespace PACKED
@@ -0,0 +1,35 @@
+#pragma once
+#include "perftTable.h"
+#include "position.h"
+#include "types.h"
+
+#include <cstdint>
+
+namespace Perft {
+/// @brief How the tree below the root is walked: make/unmake on Position or
+/// copy-make on CompactPosition
+enum class PositionMode : std::uint8_t
+{
+  MAKE_UNMAKE,
+  COPY_MAKE
+};
+
+/// @brief Counts the leaf nodes at the given depth and prints the node count
+/// for every root move (divide). Subtree counts are cached in table unless it
+/// is null.
+std::uint64_t perft(Position &pos, int depth, PerftTable *table = nullptr,
+                    PositionMode mode = PositionMode::MAKE_UNMAKE);
+
+/// @brief Same as perft but the root and sub-root subtrees are handed out to
+/// a pool of work-stealing threads. Every worker plays on its own copy of the
+/// position. The divide is printed in root move order once all workers are
+/// done, so the output is identical to the single threaded perft.
+/// The table, when given, is shared by all workers.
+std::uint64_t parallelPerft(const Position &pos, int depth, int threads,
+                            PerftTable *table = nullptr,
+                            PositionMode mode = PositionMode::MAKE_UNMAKE);
+
+/// @brief Runs perft without divide on a fixed set of positions and reports
+/// the total node count and speed
+std::uint64_t bench(PositionMode mode = PositionMode::MAKE_UNMAKE);
+} // namespace Perft
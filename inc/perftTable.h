@@ -0,0 +1,45 @@
+#pragma once
+#include "types.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/// @brief Transposition cache for perft node counts.
+/// Entries are stored as (key ^ data, data) so that a torn write from another
+/// thread is detected as a key mismatch, which makes the table safe to share
+/// between perft workers without any locks.
+class PerftTable final
+{
+public:
+  explicit PerftTable(std::size_t megaBytes);
+  PerftTable(const PerftTable &) = delete;
+  PerftTable &operator=(const PerftTable &) = delete;
+
+  bool probe(bitboard_t key, int depth, std::uint64_t &count) const;
+  void store(bitboard_t key, int depth, std::uint64_t count);
+  std::size_t sizeMB() const { return m_megaBytes; }
+
+private:
+  // Lowest 8 bits of data holds the depth, the rest is the node count
+  struct Entry
+  {
+    std::atomic<std::uint64_t> keyXorData;
+    std::atomic<std::uint64_t> data;
+  };
+
+  static constexpr std::size_t BUCKET_SIZE = 4;
+  struct alignas(64) Bucket
+  {
+    Entry entries[BUCKET_SIZE];
+  };
+  static_assert(sizeof(Bucket) == 64, "Bucket should fill one cache line");
+
+  const Bucket &bucket(bitboard_t key) const { return m_buckets[key & m_mask]; }
+  Bucket &bucket(bitboard_t key) { return m_buckets[key & m_mask]; }
+
+  std::size_t m_megaBytes;
+  std::size_t m_mask;
+  std::unique_ptr<Bucket[]> m_buckets;
+};
@@ -1,9 +1,28 @@
 #pragma once
+#include "attackFill.h"
 #include "bitboardUtil.h"
 #include "moveGen.h"
+#include "positionAttacks.h"
 #include "types.h"
+#include <array>
 #include <cassert>
 #include <string>
+#include <string_view>
+
+/// @brief Everything a move changed on the board. A move touches at most three
+/// piece boards (promotion with a capture), kept as a type and an XOR mask;
+/// unused slots XOR nothing into the occupancy, which is rebuilt anyway. The
+/// squares hold their pieces from before the move, so taking a move back is
+/// the same handful of stores for every kind of move.
+struct UndoDelta final
+{
+  std::array<bitboard_t, 3> pieceMasks{};
+  std::array<bitboard_t, NUM_COLORS> teamMasks{};
+  std::array<PieceType, 3> pieceTypes{};
+  std::array<square_t, 4> squares{}; // Restored back to front
+  std::array<PieceType, 4> pieces{};
+  std::array<square_t, NUM_COLORS> kings{};
+};
 
 struct StateInfo final
 {
@@ -11,35 +30,107 @@ struct StateInfo final
   std::uint8_t castlingRights;
   square_t enPassant;
   PieceType capturedPiece;
+  std::uint16_t rule50; // Plies since the last capture or pawn move
   score_t materialScore = 0;
   score_t materialValue = 0;
 
-  // Recomputed during doMove
-  bitboard_t blockForKing = 0;
-  bitboard_t pinnedMask = 0;
-  bitboard_t checkers = 0;
+  // Recomputed during doMove, all for the side to move
+  bitboard_t blockForKing = 0; // Squares that resolve a check
+  bitboard_t pinnedMask = 0;   // Own pieces pinned to the king
+  bitboard_t checkers = 0;     // Enemy pieces giving check
+  // Whether the two fields below are filled, see fillCheckSquares
+  bool hasCheckSquares = false;
+
+  // Filled on first use, squares from which a pawn, knight, bishop or rook
+  // would check the enemy king, and own pieces that uncover a check when they
+  // leave their line
+  std::array<bitboard_t, 4> checkSquares{};
+  bitboard_t discoverers = 0;
 
   bitboard_t hashKey = 0;
   StateInfo *prevSt = nullptr;
 
+  // Written by doMove, read by undoMove
+  UndoDelta delta;
+
   constexpr StateInfo()
-      : castlingRights(0), enPassant(SQ_NONE), capturedPiece(NO_PIECE)
+      : castlingRights(0), enPassant(SQ_NONE), capturedPiece(NO_PIECE),
+        rule50(0)
   {}
 };
 
+/// @brief A position in 32 bytes for storing and moving large sets of them.
+/// The pieces are listed in the order of the occupancy bits, two four bit
+/// codes per byte with the low nibble first: the piece type, plus 8 for black.
+/// In memory the fields are in host byte order, files hold them little endian.
+struct PackedPosition final
+{
+  bitboard_t occupancy;
+  std::array<std::uint8_t, 16> pieces;
+  std::uint8_t flags; // Black to move in bit 0, castling rights above
+  square_t enPassant;
+  std::uint16_t rule50;
+  std::uint16_t fullMove;
+  std::uint16_t reserved; // Written as zero
+};
+
+static_assert(sizeof(PackedPosition) == 32,
+              "PackedPosition should take 32 bytes");
+
+/// @brief What a move does to the board, each kind has its own make and
+/// unmake so that the hot paths only run the updates the kind needs
+enum class MoveKind : std::uint8_t
+{
+  QUIET,
+  CAPTURE,
+  DOUBLE_PUSH,
+  EN_PASSANT,
+  CASTLE,
+  PROMOTION // With or without a capture
+};
+
 // Inherits irreversible info from StateInfo
 class Position final
 {
 public:
+  /// @brief Moves are taken back with undoMove, see CompactPosition for the
+  /// copy-make alternative
+  static constexpr bool COPY_MAKE = false;
+  /// @brief Longest fen writeFen produces, five digit clocks included
+  static constexpr std::size_t MAX_FEN_LENGTH = 93;
+
   explicit Position() = default;
 
   void init();
 
-  void fenInit(const std::string &fen, StateInfo &st);
+  /// @brief Sets up the position from a fen, the clocks are optional. A fen
+  /// that does not describe a legal setup is rejected and leaves the position
+  /// and st untouched.
+  /// @return Whether the fen was accepted
+  bool fenInit(std::string_view fen, StateInfo &st);
+  PackedPosition encode() const;
+  /// @brief Sets up a packed position, checked like a fen. A rejected one
+  /// leaves the position and st untouched.
+  /// @return Whether the packed position was accepted
+  bool decode(const PackedPosition &packed, StateInfo &st);
+  /// @brief Writes the fen of the position, clocks included, without a
+  /// terminating zero. The buffer must hold MAX_FEN_LENGTH characters.
+  /// @return One past the last character written
+  char *writeFen(char *buffer) const;
+  /// @brief Copies the board of another position. The current state is copied
+  /// into st, which becomes the root of this position's state stack.
+  void copyFrom(const Position &other, StateInfo &st);
   void doMove(Move move, StateInfo &newSt);
-  void undoMove(Move move);
   template <Side s> void doMove(Move move, StateInfo &newSt);
-  template <Side s> void undoMove(Move move);
+  /// @brief Makes a move already known to be of the given kind, undone by
+  /// undoMove with the same kind and the opposite side
+  template <Side s, MoveKind kind> void doMove(Move move, StateInfo &newSt);
+  template <Side s, MoveKind kind> void undoMove(Move move);
+  /// @brief Takes back the last move by replaying the delta doMove recorded,
+  /// for callers that do not know the kind of the move
+  void undoMove(Move move);
+  /// @brief The kind of a move that is about to be made
+  MoveKind moveKind(Move move) const;
 
   // Fetching pieceBoards and teamBoards (don't use with KING)
   template <Side s> constexpr bitboard_t pieces_s() const;
@@ -48,14 +139,39 @@ public:
   template <Side s> constexpr square_t kingSquare() const;
 
   /// @brief Returns a bitboard of all attackes to a square (both sides)
+  template <SliderBackend b>
   bitboard_t attackOn(square_t square, bitboard_t board) const;
+  /// @brief Static exchange evaluation: whether the side to move ends at least
+  /// threshold ahead once both sides have recaptured on the target square with
+  /// their least valuable attackers, each free to stop. Attackers behind
+  /// others join as the occupancy thins out. Pins are not looked at.
+  bool see(Move move, int threshold) const;
   StateInfo *st() const { return m_st; }
+  square_t enPassant() const { return m_st->enPassant; }
+  bitboard_t checkers() const { return m_st->checkers; }
+  bitboard_t pinnedMask() const { return m_st->pinnedMask; }
+  bitboard_t blockForKing() const { return m_st->blockForKing; }
+  /// @brief Squares from which a piece of the given type, pawn to queen,
+  /// would check the enemy king
+  bitboard_t checkSquares(PieceType pt) const;
+  /// @brief Whether the move checks the enemy king, directly, by uncovering a
+  /// slider, with the promoted piece, with the castling rook or through the
+  /// pawn taken en passant. The move must be pseudo legal.
+  bool givesCheck(Move move) const;
+  /// @brief Whether the move could have been generated in this position, pins
+  /// and checks aside. Any move_t is accepted, hash and killer moves come from
+  /// other positions.
+  bool isPseudoLegal(Move move) const;
+  /// @brief Whether a pseudo legal move leaves the own king safe
+  bool isLegal(Move move) const;
+  bitboard_t hashKey() const { return m_st->hashKey; }
   constexpr PieceType pieceOn(square_t square) const;
-  bool isSafeSquares(bitboard_t squaresToCheck, bitboard_t board,
-                     bitboard_t attackers) const;
+  /// @brief Returns every square attacked by side s given the occupancy
+  template <Side s, SliderBackend b>
+  bitboard_t attackedSquares(bitboard_t occupancy) const;
 
   template <Side s> bool hasPawnsOnEpRank() const;
-  template <Side s>
+  template <Side s, SliderBackend b>
   bool isSpecialEnPassantKingPin(bitboard_t epPawn,
                                  const BitboardUtil::Masks *masks) const;
   bool isWhiteToMove() const;
@@ -70,9 +186,53 @@ public:
   void printState() const;
 
 private:
+  /// @brief A position read by fenInit or decode, stored by setUp once
+  /// checkSetup accepted it
+  struct Setup final
+  {
+    PieceType board[SQ_COUNT];
+    bitboard_t pieceBoards[KING + 1]; // Kings get a board of their own
+    bitboard_t teamBoards[NUM_COLORS];
+    square_t kings[NUM_COLORS];
+    std::uint8_t castlingRights;
+    square_t enPassant;
+    std::uint16_t rule50;
+    std::uint16_t fullMove;
+    bool whiteToMove;
+  };
+
+  /// @brief Fills the board arrays of setup from piece codes by square, the
+  /// piece type plus 8 for black
+  static void splitCodes(const std::uint8_t *codes, Setup &setup);
+  /// @brief Checks the rules a legal setup follows and finds the kings. An en
+  /// passant square nobody can take on is dropped, as doMove does.
+  static bool checkSetup(Setup &setup);
+  /// @brief Stores an accepted setup, pieceKey hashes its pieces alone
+  void setUp(const Setup &setup, bitboard_t pieceKey, StateInfo &st);
+  template <SliderBackend b> bool see(Move move, int threshold) const;
+  template <Side s> bool givesCheck(Move move) const;
+  template <Side s, SliderBackend b> bool givesCheck(Move move) const;
+  template <Side s> bool isPseudoLegal(Move move) const;
+  template <Side s, SliderBackend b> bool isPseudoLegal(Move move) const;
+  template <Side s> bool isLegal(Move move) const;
+  template <Side s, SliderBackend b> bool isLegal(Move move) const;
+
   // Small inline methods
   template <Side s> bitboard_t EPpawns() const;
 
+  /// @brief Fills in checkers, pinned pieces and the check blocking squares
+  /// for side s, which is the side to move
+  template <Side s> void updateCheckInfo();
+  /// @brief Fills the check squares and discoverers of the current state.
+  /// Only givesCheck needs them, so doMove leaves them to the first caller.
+  void fillCheckSquares() const;
+  template <Side s> void fillCheckSquares() const;
+  template <Side s, SliderBackend b> void fillCheckSquares() const;
+
+  /// @brief XORs the bitboards of a delta and rebuilds the occupancy, doing
+  /// and undoing it alike
+  void applyDelta(const UndoDelta &delta);
+
   //////////////////
   // Data members //
   //////////////////
@@ -84,9 +244,6 @@ private:
   bitboard_t m_teamBoards[NUM_COLORS];
   PieceType m_board[SQ_COUNT];
 
-  // Check boards
-  bitboard_t m_checkSquares[4];
-
   bool m_whiteToMove;
   uint16_t m_ply;
 };
@@ -131,6 +288,56 @@ inline constexpr PieceType Position::pieceOn(square_t square) const
   return m_board[square];
 }
 
+inline void Position::applyDelta(const UndoDelta &delta)
+{
+  m_pieceBoards[delta.pieceTypes[0]] ^= delta.pieceMasks[0];
+  m_pieceBoards[delta.pieceTypes[1]] ^= delta.pieceMasks[1];
+  m_pieceBoards[delta.pieceTypes[2]] ^= delta.pieceMasks[2];
+  m_teamBoards[BitboardUtil::WHITE] ^= delta.teamMasks[BitboardUtil::WHITE];
+  m_teamBoards[BitboardUtil::BLACK] ^= delta.teamMasks[BitboardUtil::BLACK];
+  m_pieceBoards[ALL_PIECES] =
+      m_teamBoards[BitboardUtil::WHITE] | m_teamBoards[BitboardUtil::BLACK];
+}
+
+inline void Position::undoMove([[maybe_unused]] const Move move)
+{
+  const UndoDelta &delta = m_st->delta;
+  assert(m_board[move.getFrom()] == NO_PIECE);
+
+  applyDelta(delta);
+  // Back to front, so a repeated from square ends with the moved piece
+  for (index_t slot = delta.squares.size(); slot-- > 0;)
+  {
+    m_board[delta.squares[slot]] = delta.pieces[slot];
+  }
+  m_kings[BitboardUtil::WHITE] = delta.kings[BitboardUtil::WHITE];
+  m_kings[BitboardUtil::BLACK] = delta.kings[BitboardUtil::BLACK];
+
+  m_whiteToMove = !m_whiteToMove;
+  m_ply--;
+  m_st = m_st->prevSt; // Reset state
+}
+
+inline MoveKind Position::moveKind(const Move move) const
+{
+  switch (move.getFlags())
+  {
+  case NO_FLAG:
+    if (move.isDoubleJump())
+    {
+      return MoveKind::DOUBLE_PUSH;
+    }
+    return m_board[move.getTo()] != NO_PIECE ? MoveKind::CAPTURE
+                                             : MoveKind::QUIET;
+  case EN_PASSANT:
+    return MoveKind::EN_PASSANT;
+  case CASTLE:
+    return MoveKind::CASTLE;
+  default:
+    return MoveKind::PROMOTION;
+  }
+}
+
 template <Side s> inline bool Position::hasPawnsOnEpRank() const
 {
   return EPpawns<s>() != 0;
@@ -141,4 +348,53 @@ template <Side s> inline constexpr std::uint8_t Position::castleRights() const
   return s == Side::WHITE ? m_st->castlingRights : m_st->castlingRights >> 2U;
 }
 
-inline bool Position::isWhiteToMove() const { return m_whiteToMove; }
\ No newline at end of file
+inline bool Position::isWhiteToMove() const { return m_whiteToMove; }
+
+inline bitboard_t Position::checkSquares(const PieceType pt) const
+{
+  if (!m_st->hasCheckSquares)
+  {
+    fillCheckSquares();
+  }
+  return pt == QUEEN ? m_st->checkSquares[BISHOP - PAWN] |
+                           m_st->checkSquares[ROOK - PAWN]
+                     : m_st->checkSquares[pt - PAWN];
+}
+
+template <SliderBackend b>
+inline bitboard_t Position::attackOn(const square_t square,
+                                     const bitboard_t board) const
+{
+  FILL::SliderMaps sliders;
+  if constexpr (b == SliderBackend::PORTABLE)
+  {
+    sliders = FILL::sliderAttacks(BB(square), BB(square), board);
+  }
+  else
+  {
+    sliders = {ATTACKS::sliderAttacks<ROOK, b>(board, square),
+               ATTACKS::sliderAttacks<BISHOP, b>(board, square)};
+  }
+  return (MoveGen::attacks<Side::WHITE, PAWN>(0, square) &
+          pieces<Side::BLACK, PAWN>()) |
+         (MoveGen::attacks<Side::BLACK, PAWN>(0, square) &
+          pieces<Side::WHITE, PAWN>()) |
+         (sliders.orthogonal & pieces<ROOK, QUEEN>()) |
+         (sliders.diagonal & pieces<BISHOP, QUEEN>()) |
+         (PseudoAttacks::KnightAttacks[square] & pieces<KNIGHT>()) |
+         (PseudoAttacks::KingAttacks[square] & pieces<KING>());
+}
+
+template <Side s, SliderBackend b>
+inline bitboard_t Position::attackedSquares(const bitboard_t occupancy) const
+{
+  return PositionAttacks::attackedSquares<s, b>(*this, occupancy);
+}
+
+template <Side s, SliderBackend b>
+inline bool
+Position::isSpecialEnPassantKingPin(const bitboard_t epPawn,
+                                    const BitboardUtil::Masks *masks) const
+{
+  return PositionAttacks::isSpecialEnPassantKingPin<s, b>(*this, epPawn, masks);
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+#pragma once
+#include "attackFill.h"
+#include "attackRays.h"
+#include "attacks.h"
+#include "bitboardUtil.h"
+#include "moveGen.h"
+#include "types.h"
+
+#include <array>
+
+/// @brief Attack and check queries built on the piece accessors only, shared
+/// by the make/unmake Position and the copy-make CompactPosition
+namespace PositionAttacks {
+
+/// @brief The legality masks of the side to move
+struct CheckInfo final
+{
+  bitboard_t blockForKing; // Squares that resolve a check
+  bitboard_t pinnedMask;   // Own pieces pinned to the king
+  bitboard_t checkers;     // Enemy pieces giving check
+};
+
+/// @brief Squares that resolve the given checks: all of them without a check,
+/// none in a double check, else the checker and the ray to the king
+inline bitboard_t blockForKing(const bitboard_t checkers, const square_t kingSq)
+{
+  return checkers == 0 ? BitboardUtil::All_SQ
+         : BitboardUtil::moreThanOne(checkers)
+             ? 0
+             : RayConstants::betweenBB(BitboardUtil::bitScan(checkers),
+                                       kingSq) |
+                   checkers;
+}
+
+/// @brief Every square attacked by side s given the occupancy
+template <Side s, SliderBackend b, class Pos>
+inline bitboard_t attackedSquares(const Pos &pos, const bitboard_t occupancy)
+{
+  constexpr auto masks = BitboardUtil::bitboardMasks<s>();
+  const bitboard_t pawns = pos.template pieces<s, PAWN>();
+  bitboard_t attacked =
+      BitboardUtil::shift<masks->UP_RIGHT>(pawns & masks->NOT_RIGHT_COL) |
+      BitboardUtil::shift<masks->UP_LEFT>(pawns & masks->NOT_LEFT_COL) |
+      PseudoAttacks::KingAttacks[pos.template kingSquare<s>()];
+
+  for (bitboard_t knights = pos.template pieces<s, KNIGHT>(); knights != 0;
+       knights &= knights - 1)
+  {
+    attacked |= PseudoAttacks::KnightAttacks[BitboardUtil::bitScan(knights)];
+  }
+  const bitboard_t orthogonal = pos.template pieces<s, ROOK, QUEEN>();
+  const bitboard_t diagonal = pos.template pieces<s, BISHOP, QUEEN>();
+  // The ray scan backend is far slower than the fills, the table backends
+  // are on par with them one slider at a time
+  if constexpr (b == SliderBackend::PORTABLE)
+  {
+    return attacked |
+           FILL::sliderAttacks(orthogonal, diagonal, occupancy).all();
+  }
+  for (bitboard_t bishops = diagonal; bishops != 0; bishops &= bishops - 1)
+  {
+    attacked |= ATTACKS::sliderAttacks<BISHOP, b>(
+        occupancy, BitboardUtil::bitScan(bishops));
+  }
+  for (bitboard_t rooks = orthogonal; rooks != 0; rooks &= rooks - 1)
+  {
+    attacked |= ATTACKS::sliderAttacks<ROOK, b>(
+        occupancy, BitboardUtil::bitScan(rooks));
+  }
+  return attacked;
+}
+
+/// @brief Whether taking en passant with epPawn exposes the king to a rook or
+/// queen on the rank both pawns leave
+template <Side s, SliderBackend b, class Pos>
+inline bool isSpecialEnPassantKingPin(const Pos &pos, const bitboard_t epPawn,
+                                      const BitboardUtil::Masks *masks)
+{
+  constexpr Side enemy = BitboardUtil::opposite<s>();
+  const auto kingSq = pos.template kingSquare<s>();
+  const bitboard_t realPawn =
+      BB(static_cast<index_t>(pos.enPassant() + masks->DOWN));
+  const bitboard_t snipers = pos.template pieces<enemy, ROOK, QUEEN>();
+  return (BB(kingSq) & masks->EP_RANK) != 0 &&
+         (snipers & masks->EP_RANK) != 0 &&
+         (ATTACKS::sliderAttacks<ROOK, b>(
+              pos.template pieces<ALL_PIECES>() & ~(epPawn | realPawn),
+              kingSq) &
+          snipers) != 0;
+}
+
+/// @brief Checkers, pinned pieces and the check blocking squares for side s,
+/// which is the side to move
+template <Side s, class Pos> inline CheckInfo checkInfo(const Pos &pos)
+{
+  constexpr Side enemy = BitboardUtil::opposite<s>();
+  const square_t kingSq = pos.template kingSquare<s>();
+  const bitboard_t allPieces = pos.template pieces<ALL_PIECES>();
+
+  bitboard_t checkers = (MoveGen::attacks<s, PAWN>(0, kingSq) &
+                         pos.template pieces<enemy, PAWN>()) |
+                        (MoveGen::attacks<KNIGHT>(0, kingSq) &
+                         pos.template pieces<enemy, KNIGHT>());
+  bitboard_t pinned = 0;
+
+  // Sliders on an empty board line with the king either check, pin or are
+  // blocked by more than one piece. Empty board lookups are the same for every
+  // backend and the magic tables are always built.
+  constexpr SliderBackend b = SliderBackend::MAGIC;
+  const bitboard_t snipers =
+      (ATTACKS::sliderAttacks<ROOK, b>(0, kingSq) &
+       pos.template pieces<enemy, ROOK, QUEEN>()) |
+      (ATTACKS::sliderAttacks<BISHOP, b>(0, kingSq) &
+       pos.template pieces<enemy, BISHOP, QUEEN>());
+  for (bitboard_t snips = snipers; snips != 0; snips &= snips - 1)
+  {
+    const square_t sniper = BitboardUtil::bitScan(snips);
+    const bitboard_t blockers =
+        RayConstants::betweenBB(sniper, kingSq) & allPieces;
+    if (blockers == 0)
+    {
+      checkers |= BB(sniper);
+    }
+    else if (!BitboardUtil::moreThanOne(blockers))
+    {
+      pinned |= blockers;
+    }
+  }
+
+  return {blockForKing(checkers, kingSq),
+          pinned & pos.template pieces_s<s>(), checkers};
+}
+
+/// @brief Where the pieces of side s, the side to move, would give check
+struct CheckSquares final
+{
+  std::array<bitboard_t, 4> squares; // Pawn, knight, bishop and rook
+  bitboard_t discoverers;            // Alone between a slider and the king
+};
+
+/// @brief The squares from which each piece type of side s checks the enemy
+/// king, looked up from the king, and the pieces of side s that uncover a
+/// check by moving off their line
+template <Side s, SliderBackend b, class Pos>
+inline CheckSquares checkSquares(const Pos &pos)
+{
+  constexpr Side enemy = BitboardUtil::opposite<s>();
+  const square_t kingSq = pos.template kingSquare<enemy>();
+  const bitboard_t allPieces = pos.template pieces<ALL_PIECES>();
+  const bitboard_t own = pos.template pieces_s<s>();
+
+  const bitboard_t diagonal =
+      ATTACKS::sliderAttacks<BISHOP, b>(allPieces, kingSq);
+  const bitboard_t orthogonal =
+      ATTACKS::sliderAttacks<ROOK, b>(allPieces, kingSq);
+
+  // Own pieces the king sees are lifted off the board, the own sliders that
+  // show up behind them are lined up with the king through just that piece
+  bitboard_t snipers = 0;
+  const bitboard_t diagonalSliders = pos.template pieces<s, BISHOP, QUEEN>();
+  const bitboard_t orthogonalSliders = pos.template pieces<s, ROOK, QUEEN>();
+  if (const bitboard_t shields = diagonal & own;
+      shields != 0 && diagonalSliders != 0)
+  {
+    snipers |= ATTACKS::sliderAttacks<BISHOP, b>(allPieces ^ shields, kingSq) &
+               diagonalSliders & ~diagonal;
+  }
+  if (const bitboard_t shields = orthogonal & own;
+      shields != 0 && orthogonalSliders != 0)
+  {
+    snipers |= ATTACKS::sliderAttacks<ROOK, b>(allPieces ^ shields, kingSq) &
+               orthogonalSliders & ~orthogonal;
+  }
+  bitboard_t discoverers = 0;
+  for (; snipers != 0; snipers &= snipers - 1)
+  {
+    discoverers |=
+        RayConstants::betweenBB(BitboardUtil::bitScan(snipers), kingSq) & own;
+  }
+
+  return {{MoveGen::attacks<enemy, PAWN>(0, kingSq),
+           MoveGen::attacks<KNIGHT>(0, kingSq), diagonal, orthogonal},
+          discoverers};
+}
+
+} // namespace PositionAttacks
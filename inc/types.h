@@ -77,3 +77,6 @@ enum PieceType : index_t
   KING = 6, // King is not part of the pieceBoards
   NUM_COLORS = 2,
 };
+
+// Indexed by PieceType, the king is never captured
+constexpr score_t PieceValues[KING + 1] = {0, 100, 300, 300, 500, 900, 0};
@@ -1,21 +1,79 @@
 #pragma once
 #include "bitboardUtil.h"
-/*
-class ZobristHash
+#include "types.h"
+
+#include <cstdint>
+
+class Position;
+
+namespace Zobrist {
+
+/// @brief xorshift64* generator, usable in constant expressions so that the
+/// keys are baked into the binary
+class PRNG final
 {
 public:
-  ZobristHash() { initHash(); }
-  ~ZobristHash() = default;
-  bitboard_t hashPosition(const Position &pos);
+  constexpr explicit PRNG(std::uint64_t seed) : m_state(seed) {}
 
-  bitboard_t pieceHash[10][64];
-  bitboard_t kingHash[2][64];
-  bitboard_t epHash[8];
-  bitboard_t castleHash[16];
-  bitboard_t whiteToMoveHash;
-  bitboard_t moveHash;
+  constexpr std::uint64_t next()
+  {
+    m_state ^= m_state >> 12U;
+    m_state ^= m_state << 25U;
+    m_state ^= m_state >> 27U;
+    return m_state * 2685821657736338717ULL;
+  }
 
 private:
-  void initHash();
+  std::uint64_t m_state;
 };
-*/
+
+/// @brief Random keys for every (side, piece, square), the en passant file,
+/// the castling rights and the side to move
+struct Keys final
+{
+  bitboard_t pieces[NUM_COLORS][KING + 1][SQ_COUNT];
+  bitboard_t enPassant[BitboardUtil::BOARD_DIMMENSION];
+  bitboard_t castling[16];
+  bitboard_t blackToMove;
+};
+
+constexpr Keys makeKeys()
+{
+  Keys keys{};
+  PRNG generator(0x45C4E5B0ABDA2D3FULL);
+
+  for (auto &side : keys.pieces)
+  {
+    // Index 0 (ALL_PIECES/NO_PIECE) is left zero on purpose
+    for (index_t piece = PAWN; piece <= KING; piece++)
+    {
+      for (auto &key : side[piece])
+      {
+        key = generator.next();
+      }
+    }
+  }
+  for (auto &key : keys.enPassant)
+  {
+    key = generator.next();
+  }
+  for (auto &key : keys.castling)
+  {
+    key = generator.next();
+  }
+  keys.blackToMove = generator.next();
+  return keys;
+}
+
+inline constexpr Keys KEYS = makeKeys();
+
+template <Side s> constexpr bitboard_t pieceKey(PieceType pt, square_t square)
+{
+  return KEYS.pieces[static_cast<index_t>(s)][pt][square];
+}
+
+/// @brief Computes the key of the position from scratch. Position keeps its
+/// key up to date in doMove, this is for initialization and verification.
+bitboard_t hashPosition(const Position &pos);
+
+} // namespace Zobrist
@@ -24,6 +24,7 @@
 #include "GUI.h"
 #include "bitboardUtil.h"
 #include "moveGen.h"
+#include "perft.h"
 #include "position.h"
 #include "types.h"
 
@@ -31,21 +32,33 @@
 #include <iostream>
 #include <memory>
 
-/////////////////////////////////
-/// Forward declarations ////////
-/////////////////////////////////
-namespace Perft {
-std::uint64_t perft(Position &pos, int depth);
-}
-
 Engine::Engine() : m_pos{}, m_historyList(std::make_unique<historyList_t>()) {};
 
 namespace {
-bool validateMove(Move &pseudoLegalMove, const Position &pos)
+/// @brief Typed moves carry the squares and the promotion only, the other
+/// flags follow from the board
+Move completeMove(const Move move, const Position &pos)
 {
-  pseudoLegalMove =
-      MoveGen::MoveList<MoveFilter::ALL>(pos).find(pseudoLegalMove);
-  return pseudoLegalMove.getData() != 0;
+  const square_t from = move.getFrom();
+  const square_t to = move.getTo();
+  const PieceType mover = pos.pieceOn(from);
+  if (move.getFlags() == PROMOTION)
+  {
+    return move;
+  }
+  if (mover == KING && (to == from + 2 || from == to + 2))
+  {
+    return Move::make<CASTLE>(from, to);
+  }
+  if (mover == PAWN && to == pos.enPassant())
+  {
+    return Move::make<EN_PASSANT>(from, to);
+  }
+  if (mover == PAWN && (to == from + 16 || from == to + 16))
+  {
+    return Move::make<DOUBLE_JUMP>(from, to);
+  }
+  return move;
 }
 /*
 void validateBitboard(const bitboard_t b1, const bitboard_t b2,
@@ -93,32 +106,12 @@ bool moveIntegrity(const Position &pos1, const Position &pos2, Move move,
   return result;
 }
 */
-
-template <Side s> std::uint64_t bulkCount(Position &pos, int depth)
-{
-  const MoveGen::MoveList<MoveFilter::ALL, s> moveList(pos);
-  if (depth == 1)
-  {
-    return moveList.size();
-  }
-  // StateInfo newSt;
-  std::uint64_t count = 0;
-  StateInfo newState;
-  constexpr Side enemy = BitboardUtil::opposite<s>();
-
-  for (const auto &move : moveList)
-  {
-    pos.doMove<s>(move, newState);
-    count += bulkCount<enemy>(pos, depth - 1);
-    pos.undoMove<enemy>(move);
-  }
-  return count;
-}
 } // namespace
 
 void Engine::makeMove(Move move)
 {
-  if (validateMove(move, m_pos))
+  move = completeMove(move, m_pos);
+  if (m_pos.isPseudoLegal(move) && m_pos.isLegal(move))
   {
     std::cout << GUI::makeMoveNotation(move) << " - Flags: " << move.getFlags()
               << "\n";
@@ -146,39 +139,46 @@ void Engine::undoMove()
     std::cout << "No move to undo\n";
   }
 }
-std::uint64_t Engine::runPerft(int depth) { return Perft::perft(m_pos, depth); }
-
-void Engine::initFen(const std::string &fen)
+std::uint64_t Engine::runPerft(int depth, int threads, std::size_t hashMB,
+                               const Perft::PositionMode mode)
 {
-  m_historyList->emplace_back(History(Move(), StateInfo()));
-  m_pos.fenInit(fen, m_historyList->back().state);
+  // Node counts do not depend on history, the table stays valid between runs
+  if (hashMB == 0)
+  {
+    m_perftTable.reset();
+  }
+  else if (!m_perftTable || m_perftTable->sizeMB() != hashMB)
+  {
+    m_perftTable = std::make_unique<PerftTable>(hashMB);
+  }
+  return threads > 1 ? Perft::parallelPerft(m_pos, depth, threads,
+                                             m_perftTable.get(), mode)
+                     : Perft::perft(m_pos, depth, m_perftTable.get(), mode);
 }
 
-void Engine::printPieces() const { m_pos.printPieces(""); }
-
-void Engine::printMoves() const
+std::uint64_t Engine::runBench(const Perft::PositionMode mode)
 {
-  PseudoAttacks::printMovelistMoves(
-      MoveGen::MoveList<MoveFilter::ALL>(m_pos).start());
+  return Perft::bench(mode);
 }
 
-std::uint64_t Perft::perft(Position &pos, const int depth)
+bool Engine::initFen(const std::string &fen)
 {
-  StateInfo state;
-  std::uint64_t count = 0;
-  const bool leaf = depth <= 1;
-
-  for (const auto move : MoveGen::MoveList<MoveFilter::ALL>(pos))
+  m_historyList->emplace_back(History(Move(), StateInfo()));
+  if (!m_pos.fenInit(fen, m_historyList->back().state))
   {
-    pos.doMove(move, state);
-    auto part = leaf                  ? 1
-                : pos.isWhiteToMove() ? bulkCount<Side::WHITE>(pos, depth - 1)
-                                      : bulkCount<Side::BLACK>(pos, depth - 1);
-    pos.undoMove(move);
-    count += part;
-    std::cout << GUI::makeMoveNotation(move) << ": " << part << "\n";
+    m_historyList->pop_back();
+    return false;
   }
+  return true;
+}
+
+void Engine::printPieces() const
+{
+  m_pos.printPieces(GUI::getPositionFen(m_pos));
+}
 
-  std::cout << "Total nodes visited: " << count << "\n";
-  return count;
+void Engine::printMoves() const
+{
+  PseudoAttacks::printMovelistMoves(
+      MoveGen::MoveList<MoveFilter::ALL>(m_pos).start());
 }
@@ -1,8 +1,13 @@
 #include "EngineInterface.h"
 #include "Engine.h"
 #include "GUI.h"
+#include "attackFill.h"
+#include "attacks.h"
 #include "moveGen.h"
+#include "moveSerialize.h"
+#include "packedFile.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <iostream>
@@ -17,14 +22,41 @@ inline void runGo(const std::unique_ptr<CommandArgs> &args, Engine &engine)
   const std::string &secondArg = args->getArg();
   if (secondArg == "perft")
   {
-    int depth = std::stoi(args->getNext()->getArg());
+    // go perft <depth> [threads <n>] [hash <MB>] [mode makeunmake|copymake]
+    const auto &depthArg = args->getNext();
+    int depth = std::stoi(depthArg->getArg());
+    int threads = 1;
+    std::size_t hashMB = 0;
+    auto mode = Perft::PositionMode::MAKE_UNMAKE;
+    for (const CommandArgs *option = depthArg->getNext().get();
+         option != nullptr && option->getNext();
+         option = option->getNext()->getNext().get())
+    {
+      if (option->getArg() == "threads")
+      {
+        threads = std::max(1, std::stoi(option->getNext()->getArg()));
+      }
+      else if (option->getArg() == "hash")
+      {
+        hashMB = std::stoul(option->getNext()->getArg());
+      }
+      else if (option->getArg() == "mode" &&
+               option->getNext()->getArg() == "copymake")
+      {
+        mode = Perft::PositionMode::COPY_MAKE;
+      }
+    }
     auto start = std::chrono::system_clock::now();
-    engine.runPerft(depth);
+    const std::uint64_t nodes = engine.runPerft(depth, threads, hashMB, mode);
     auto end = std::chrono::system_clock::now();
     auto duration =
         std::chrono::duration_cast<std::chrono::milliseconds>(end - start)
             .count();
     std::cout << "Execution time: " << duration << " ms\n";
+    std::cout << "Threads: " << threads << "\n";
+    const auto elapsed = static_cast<std::uint64_t>(
+        std::max<decltype(duration)>(duration, 1));
+    std::cout << "Nodes/second: " << nodes * 1000 / elapsed << "\n";
   }
   // Do other go commands
 }
@@ -34,7 +66,44 @@ inline void uciInput()
   std::cout << "id name " << ENGINE_ID << '\n';
   std::cout << "id author "
             << "Nosslrac\n";
-  std::cout << "uciok\n";
+  std::cout << "option name SliderAttacks type combo default "
+            << ATTACKS::backendName(ATTACKS::detectBackend());
+  for (const auto backend : SLIDER_BACKENDS)
+  {
+    if (ATTACKS::isSupported(backend))
+    {
+      std::cout << " var " << ATTACKS::backendName(backend);
+    }
+  }
+  std::cout << "\nuciok\n";
+}
+
+inline void setOption(const std::unique_ptr<CommandArgs> &args)
+{
+  // setoption name <name> value <value>
+  if (!args || args->getArg() != "name" || !args->getNext())
+  {
+    std::cout << "Unknown option\n";
+    return;
+  }
+  const auto &name = args->getNext();
+  const auto &valueArg = name->getNext();
+  if (name->getArg() != "SliderAttacks" || !valueArg ||
+      valueArg->getArg() != "value" || !valueArg->getNext())
+  {
+    std::cout << "Unknown option\n";
+    return;
+  }
+
+  SliderBackend backend = SliderBackend::MAGIC;
+  if (!ATTACKS::parseBackend(valueArg->getNext()->getArg(), backend) ||
+      !ATTACKS::setBackend(backend))
+  {
+    std::cout << "Unsupported slider backend "
+              << valueArg->getNext()->getArg() << "\n";
+    return;
+  }
+  std::cout << "Slider attacks: " << ATTACKS::backendName(backend) << "\n";
 }
 
 } // namespace UCI
@@ -48,7 +117,10 @@ inline void setPosition(const CommandArgs &args, Engine &engine)
   }
   else if (secondArg == "fen")
   {
-    engine.initFen(args.getNext()->getArg());
+    if (!engine.initFen(args.getNext()->getArg()))
+    {
+      std::cout << "Invalid fen\n";
+    }
   }
   else
   {
@@ -68,9 +140,8 @@ void EngineParser::runInterface()
   std::cout << "Welcome to ExplorerChess v1.0\n";
   m_engine.initFen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
 
-  while (true)
+  while (receiveInput())
   {
-    receiveInput();
   }
 }
 
@@ -113,10 +184,13 @@ std::size_t CommandArgs::size() const
   return 1 + m_next->size();
 }
 
-void EngineParser::receiveInput()
+bool EngineParser::receiveInput()
 {
   std::string userInput;
-  std::getline(std::cin, userInput);
+  if (!std::getline(std::cin, userInput))
+  {
+    return false;
+  }
   CommandArgs args(userInput);
 
   if (m_mode == EngineMode::UCI)
@@ -124,10 +198,42 @@ void EngineParser::receiveInput()
     // Do uci stuff
   }
 
+  if (args.getArg() == "quit")
+  {
+    return false;
+  }
   if (args.getArg() == "go")
   {
     UCI::runGo(args.getNext(), m_engine);
   }
+  else if (args.getArg() == "bench")
+  {
+    // bench [fill|serialize|fen|packed|copymake]
+    if (args.getNext() && args.getNext()->getArg() == "fill")
+    {
+      FILL::bench();
+    }
+    else if (args.getNext() && args.getNext()->getArg() == "serialize")
+    {
+      SERIALIZE::bench();
+    }
+    else if (args.getNext() && args.getNext()->getArg() == "fen")
+    {
+      GUI::benchFen();
+    }
+    else if (args.getNext() && args.getNext()->getArg() == "packed")
+    {
+      PACKED::bench();
+    }
+    else if (args.getNext() && args.getNext()->getArg() == "copymake")
+    {
+      m_engine.runBench(Perft::PositionMode::COPY_MAKE);
+    }
+    else
+    {
+      m_engine.runBench();
+    }
+  }
   else if (args.getArg() == "d")
   {
     m_engine.printPieces();
@@ -148,6 +254,10 @@ void EngineParser::receiveInput()
   {
     undoMove(m_engine);
   }
+  else if (args.getArg() == "setoption")
+  {
+    UCI::setOption(args.getNext());
+  }
   else if (args.getArg() == "uci")
   {
     m_mode = EngineMode::UCI;
@@ -157,5 +267,6 @@ void EngineParser::receiveInput()
   {
     std::cout << "Unknown command\n";
   }
+  return true;
 }
 } // namespace ExplorerChess
\ No newline at end of file
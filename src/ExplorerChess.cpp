@@ -1,10 +1,7 @@
 #include "EngineInterface.h"
-#include "attackPextV2.h"
 
 int main()
 {
-  ATTACKS::init();
-
   // pos.fenInit("4k3/4b3/8/r7/8/4B3/2R5/4K3 w - - 0 1", st);
   // pos.fenInit("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq 0 1", st);
   // auto attackers = pos.attackOn(53, pos.pieces<ALL_PIECES>());
@@ -1,56 +1,60 @@
 #include "GUI.h"
 #include "moveGen.h"
+#include "position.h"
+#include <chrono>
 #include <format>
 #include <iostream>
 #include <string_view>
 
 namespace GUI {
 namespace {
-constexpr std::string_view PieceIndexes(" PNBRQK pnbrqk");
 constexpr std::string_view CastlingIndexes("KQkq");
-constexpr std::string_view SideToMove("wb");
 
 } // namespace
 
-// Returns the fen for the current position
-void getPositionFen(const Position &pos)
+std::string getPositionFen(const Position &pos)
 {
-  int empty = 0;
-  std::string fen = "Fen: ";
+  char buffer[Position::MAX_FEN_LENGTH];
+  return {buffer, pos.writeFen(buffer)};
+}
+
+void benchFen()
+{
+  constexpr int ROUNDS = 500000;
 
-  for (std::size_t i = 0;
-       i < BitboardUtil::BOARD_DIMMENSION * BitboardUtil::BOARD_DIMMENSION; i++)
+  Position positions[std::size(BENCH_FENS)];
+  StateInfo states[std::size(BENCH_FENS)];
+  char buffer[Position::MAX_FEN_LENGTH];
+  std::size_t accepted = 0;
+  std::size_t written = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < ROUNDS; round++)
   {
-    if (i % BitboardUtil::BOARD_DIMMENSION == 0 && i != 0)
+    for (std::size_t i = 0; i < std::size(BENCH_FENS); i++)
     {
-      if (empty != 0)
-      {
-        fen += static_cast<char>('0' + empty);
-        empty = 0;
-      }
-      fen += '/';
+      accepted += positions[i].fenInit(BENCH_FENS[i], states[i]) ? 1 : 0;
     }
-    if (pos.pieceOn(square_t(i)) == NO_PIECE)
-    {
-      empty++;
-    }
-    else
+  }
+  const auto parsed = std::chrono::steady_clock::now();
+  for (int round = 0; round < ROUNDS; round++)
+  {
+    for (const auto &pos : positions)
     {
-      if (empty)
-      {
-        fen += static_cast<char>('0' + empty);
-        empty = 0;
-      }
-      fen += PieceIndexes[pos.pieceOn(square_t(i))];
+      written += static_cast<std::size_t>(pos.writeFen(buffer) - buffer);
     }
   }
-  const char side = SideToMove[pos.isWhiteToMove() ? 0 : 1];
-  std::string castle = getCastleRights(pos);
-  std::string enPassant = pos.st()->enPassant == SQ_NONE
-                              ? makeSquareNotation(pos.st()->enPassant)
-                              : "";
+  const auto end = std::chrono::steady_clock::now();
 
-  std::cout << fen << castle << side;
+  const auto fens = static_cast<double>(ROUNDS * std::size(BENCH_FENS));
+  const auto seconds = [](const auto duration) {
+    return std::chrono::duration<double>(duration).count();
+  };
+  const double parseSeconds = seconds(parsed - start);
+  const double writeSeconds = seconds(end - parsed);
+  std::cout << "fen parse: " << fens / parseSeconds / 1e6 << " M fens/s ("
+            << accepted << " accepted)\n";
+  std::cout << "fen write: " << fens / writeSeconds / 1e6 << " M fens/s ("
+            << written << " chars)\n";
 }
 
 square_t makeSquare(char col, char row)
@@ -82,7 +86,7 @@ Move parseMove(std::string moveNotation)
     constexpr std::string_view promos = "nbrq";
     if (auto id = promos.find(moveNotation.at(4)); id != std::string::npos)
     {
-      return Move::make<PROMOTION>(from, to, PieceType(id));
+      return Move::make<PROMOTION>(from, to, PieceType(KNIGHT + id));
     }
   }
   return Move::make(from, to);
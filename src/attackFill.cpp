@@ -0,0 +1,373 @@
+#include "attackFill.h"
+#include "attacks.h"
+#include "bitboardUtil.h"
+#include "types.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+using PORTABLE_ATTACK::RAY_DIRECTIONS;
+
+// Squares a shift in each ray direction may land on without wrapping around
+// the board, in the order of RAY_DIRECTIONS
+constexpr bitboard_t NOT_FILE_A = ~BitboardUtil::FileA;
+constexpr bitboard_t NOT_FILE_H = ~BitboardUtil::FileH;
+constexpr bitboard_t ALL = BitboardUtil::All_SQ;
+constexpr bitboard_t WRAP_MASKS[8] = {NOT_FILE_A, ALL, NOT_FILE_A, NOT_FILE_H,
+                                      NOT_FILE_H, ALL, NOT_FILE_H, NOT_FILE_A};
+
+// Ray directions 0, 1, 4 and 5 are orthogonal, the others diagonal
+constexpr bool isOrthogonal(const int dir) { return (dir & 2) == 0; }
+
+inline bitboard_t shiftBy(const bitboard_t bb, const int step)
+{
+  return step > 0 ? bb << step : bb >> -step;
+}
+
+bitboard_t occludedFill(bitboard_t gen, bitboard_t empty, const int dir)
+{
+  const int step = RAY_DIRECTIONS[dir];
+  const bitboard_t wrap = WRAP_MASKS[dir];
+  empty &= wrap;
+  gen |= empty & shiftBy(gen, step);
+  empty &= shiftBy(empty, step);
+  gen |= empty & shiftBy(gen, 2 * step);
+  empty &= shiftBy(empty, 2 * step);
+  gen |= empty & shiftBy(gen, 4 * step);
+  return shiftBy(gen, step) & wrap;
+}
+
+FILL::SliderMaps fillScalar(const bitboard_t orthogonal,
+                            const bitboard_t diagonal,
+                            const bitboard_t occupancy)
+{
+  FILL::SliderMaps maps{0, 0};
+  for (int dir = 0; dir < 8; dir++)
+  {
+    if (isOrthogonal(dir))
+    {
+      maps.orthogonal |= occludedFill(orthogonal, ~occupancy, dir);
+    }
+    else
+    {
+      maps.diagonal |= occludedFill(diagonal, ~occupancy, dir);
+    }
+  }
+  return maps;
+}
+
+#if defined(__x86_64__)
+
+// Variable shifts by 64 or more give zero, so every lane shifts by one of the
+// two counts and the other is a no-op
+__attribute__((target("avx2"))) FILL::SliderMaps
+fillAvx2(const bitboard_t orthogonal, const bitboard_t diagonal,
+         const bitboard_t occupancy)
+{
+  // The increasing square directions shift left, the others right
+  const __m256i steps = _mm256_setr_epi64x(1, 8, 9, 7);
+  const __m256i gen0 = _mm256_setr_epi64x(
+      static_cast<long long>(orthogonal), static_cast<long long>(orthogonal),
+      static_cast<long long>(diagonal), static_cast<long long>(diagonal));
+  const __m256i empty = _mm256_set1_epi64x(static_cast<long long>(~occupancy));
+  const __m256i wrapLeft = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i *>(WRAP_MASKS));
+  const __m256i wrapRight = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i *>(WRAP_MASKS + 4));
+
+  __m256i genLeft = gen0;
+  __m256i genRight = gen0;
+  __m256i proLeft = _mm256_and_si256(empty, wrapLeft);
+  __m256i proRight = _mm256_and_si256(empty, wrapRight);
+  __m256i count = steps;
+  for (int i = 0; i < 3; i++)
+  {
+    genLeft = _mm256_or_si256(
+        genLeft, _mm256_and_si256(proLeft, _mm256_sllv_epi64(genLeft, count)));
+    genRight = _mm256_or_si256(
+        genRight,
+        _mm256_and_si256(proRight, _mm256_srlv_epi64(genRight, count)));
+    proLeft = _mm256_and_si256(proLeft, _mm256_sllv_epi64(proLeft, count));
+    proRight = _mm256_and_si256(proRight, _mm256_srlv_epi64(proRight, count));
+    count = _mm256_add_epi64(count, count);
+  }
+  const __m256i attacks = _mm256_or_si256(
+      _mm256_and_si256(_mm256_sllv_epi64(genLeft, steps), wrapLeft),
+      _mm256_and_si256(_mm256_srlv_epi64(genRight, steps), wrapRight));
+
+  alignas(32) bitboard_t lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), attacks);
+  return FILL::SliderMaps{lanes[0] | lanes[1], lanes[2] | lanes[3]};
+}
+
+// GCC reports the undefined pass-through register of its own AVX-512 shift
+// intrinsics as uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+__attribute__((target("avx512f"))) FILL::SliderMaps
+fillAvx512(const bitboard_t orthogonal, const bitboard_t diagonal,
+           const bitboard_t occupancy)
+{
+  // All eight directions in one register, the first four shift left
+  __m512i left = _mm512_setr_epi64(1, 8, 9, 7, 64, 64, 64, 64);
+  __m512i right = _mm512_setr_epi64(64, 64, 64, 64, 1, 8, 9, 7);
+  const __m512i stepLeft = left;
+  const __m512i stepRight = right;
+  const auto orth = static_cast<long long>(orthogonal);
+  const auto diag = static_cast<long long>(diagonal);
+  __m512i gen =
+      _mm512_setr_epi64(orth, orth, diag, diag, orth, orth, diag, diag);
+  const __m512i wrap = _mm512_loadu_si512(WRAP_MASKS);
+  __m512i pro = _mm512_and_si512(
+      _mm512_set1_epi64(static_cast<long long>(~occupancy)), wrap);
+
+  for (int i = 0; i < 3; i++)
+  {
+    const __m512i shiftedGen = _mm512_or_si512(_mm512_sllv_epi64(gen, left),
+                                               _mm512_srlv_epi64(gen, right));
+    gen = _mm512_or_si512(gen, _mm512_and_si512(pro, shiftedGen));
+    pro = _mm512_and_si512(pro, _mm512_or_si512(_mm512_sllv_epi64(pro, left),
+                                                _mm512_srlv_epi64(pro, right)));
+    left = _mm512_add_epi64(left, left);
+    right = _mm512_add_epi64(right, right);
+  }
+  const __m512i attacks = _mm512_and_si512(
+      _mm512_or_si512(_mm512_sllv_epi64(gen, stepLeft),
+                      _mm512_srlv_epi64(gen, stepRight)),
+      wrap);
+
+  // One fold of the right shifts onto the left ones, then the same split as
+  // the AVX2 kernel instead of two horizontal reductions
+  const __m256i folded =
+      _mm256_or_si256(_mm512_castsi512_si256(attacks),
+                      _mm512_extracti64x4_epi64(attacks, 1));
+  alignas(32) bitboard_t lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), folded);
+  return FILL::SliderMaps{lanes[0] | lanes[1], lanes[2] | lanes[3]};
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+// AVX2 ranks first, the AVX-512 kernel measures slower (buildPerformance.txt)
+FILL::Kernel detectKernel()
+{
+  using FILL::Kernel;
+  return FILL::isSupported(Kernel::AVX2)     ? Kernel::AVX2
+         : FILL::isSupported(Kernel::AVX512) ? Kernel::AVX512
+                                             : Kernel::SCALAR;
+}
+
+// Picks the fastest supported kernel once, before main runs
+FILL::Kernel ActiveKernel = detectKernel();
+
+} // namespace
+
+bool FILL::isSupported(const Kernel kernel)
+{
+#if defined(__x86_64__)
+  // Also called by static initializers, before the CPU model is known
+  __builtin_cpu_init();
+  switch (kernel)
+  {
+  case Kernel::AVX512:
+    return __builtin_cpu_supports("avx512f");
+  case Kernel::AVX2:
+    return __builtin_cpu_supports("avx2");
+  default:
+    return true;
+  }
+#else
+  return kernel == Kernel::SCALAR;
+#endif
+}
+
+FILL::Kernel FILL::kernel() { return ActiveKernel; }
+
+bool FILL::setKernel(const Kernel kernel)
+{
+  if (!isSupported(kernel))
+  {
+    return false;
+  }
+  ActiveKernel = kernel;
+  return true;
+}
+
+std::string_view FILL::kernelName(const Kernel kernel)
+{
+  switch (kernel)
+  {
+  case Kernel::AVX512:
+    return "avx512";
+  case Kernel::AVX2:
+    return "avx2";
+  default:
+    return "scalar";
+  }
+}
+
+FILL::SliderMaps FILL::sliderAttacks(const bitboard_t orthogonal,
+                                     const bitboard_t diagonal,
+                                     const bitboard_t occupancy)
+{
+  return sliderAttacks(ActiveKernel, orthogonal, diagonal, occupancy);
+}
+
+FILL::SliderMaps FILL::sliderAttacks(const Kernel kernel,
+                                     const bitboard_t orthogonal,
+                                     const bitboard_t diagonal,
+                                     const bitboard_t occupancy)
+{
+  switch (kernel)
+  {
+#if defined(__x86_64__)
+  case Kernel::AVX512:
+    return fillAvx512(orthogonal, diagonal, occupancy);
+  case Kernel::AVX2:
+    return fillAvx2(orthogonal, diagonal, occupancy);
+#endif
+  default:
+    return fillScalar(orthogonal, diagonal, occupancy);
+  }
+}
+
+namespace {
+
+struct FillSample
+{
+  bitboard_t orthogonal;
+  bitboard_t diagonal;
+  bitboard_t occupancy;
+};
+
+template <SliderBackend b> bitboard_t lookupLoop(const FillSample &sample)
+{
+  bitboard_t attacks = 0;
+  for (bitboard_t rooks = sample.orthogonal; rooks != 0; rooks &= rooks - 1)
+  {
+    attacks |= ATTACKS::sliderAttacks<ROOK, b>(sample.occupancy,
+                                               BitboardUtil::bitScan(rooks));
+  }
+  for (bitboard_t bishops = sample.diagonal; bishops != 0;
+       bishops &= bishops - 1)
+  {
+    attacks |= ATTACKS::sliderAttacks<BISHOP, b>(
+        sample.occupancy, BitboardUtil::bitScan(bishops));
+  }
+  return attacks;
+}
+
+template <class MapFunction>
+void timeMaps(const std::string_view name,
+              const std::vector<FillSample> &samples, const MapFunction &map)
+{
+  constexpr int ROUNDS = 200;
+  bitboard_t checksum = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < ROUNDS; round++)
+  {
+    for (const auto &sample : samples)
+    {
+      checksum ^= map(sample) + static_cast<bitboard_t>(round);
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const double ns =
+      static_cast<double>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+              .count()) /
+      static_cast<double>(ROUNDS * samples.size());
+  std::cout << name << ": " << ns << " ns/map (checksum " << checksum
+            << ")\n";
+}
+
+} // namespace
+
+void FILL::bench()
+{
+  // Middle game like sets, two rooks, two bishops and a queen among about
+  // two dozen pieces
+  std::vector<FillSample> samples;
+  bitboard_t seed = 0x9E3779B97F4A7C15ULL;
+  const auto next = [&seed]() {
+    seed ^= seed >> 12;
+    seed ^= seed << 25;
+    seed ^= seed >> 27;
+    return seed * 2685821657736338717ULL;
+  };
+  const auto pick = [&](bitboard_t from, int count) {
+    bitboard_t picked = 0;
+    while (count-- > 0 && from != 0)
+    {
+      bitboard_t square = BB(next() % SQ_COUNT);
+      for (; (square & from) == 0; square = BB(next() % SQ_COUNT))
+      {
+      }
+      picked |= square;
+      from &= ~square;
+    }
+    return picked;
+  };
+  for (int i = 0; i < 4096; i++)
+  {
+    const bitboard_t occupancy = pick(BitboardUtil::All_SQ, 24);
+    const bitboard_t rooks = pick(occupancy, 2);
+    const bitboard_t bishops = pick(occupancy & ~rooks, 2);
+    const bitboard_t queen = pick(occupancy & ~(rooks | bishops), 1);
+    samples.push_back({rooks | queen, bishops | queen, occupancy});
+  }
+
+  for (const auto backend : SLIDER_BACKENDS)
+  {
+    if (!ATTACKS::isSupported(backend))
+    {
+      continue;
+    }
+    const std::string name =
+        "lookup loop " + std::string(ATTACKS::backendName(backend));
+    switch (backend)
+    {
+    case SliderBackend::PEXT:
+      timeMaps(name, samples, lookupLoop<SliderBackend::PEXT>);
+      break;
+    case SliderBackend::PEXT_PDEP:
+      timeMaps(name, samples, lookupLoop<SliderBackend::PEXT_PDEP>);
+      break;
+    case SliderBackend::MAGIC:
+      timeMaps(name, samples, lookupLoop<SliderBackend::MAGIC>);
+      break;
+    default:
+      timeMaps(name, samples, lookupLoop<SliderBackend::PORTABLE>);
+      break;
+    }
+  }
+
+  for (const auto fillKernel : {Kernel::SCALAR, Kernel::AVX2, Kernel::AVX512})
+  {
+    if (!isSupported(fillKernel))
+    {
+      continue;
+    }
+    timeMaps("fill " + std::string(kernelName(fillKernel)), samples,
+             [fillKernel](const FillSample &sample) {
+               return sliderAttacks(fillKernel, sample.orthogonal,
+                                    sample.diagonal, sample.occupancy)
+                   .all();
+             });
+  }
+}
@@ -1,15 +1,22 @@
 #include "attackPextV2.h"
+#include "attacks.h"
 
 #include <array>
+#include <bit>
 #include <cassert>
-#include <cmath>
-#include <iostream>
+#include <utility>
 
 #include "bitboardUtil.h"
 #include "types.h"
 
+// All slider tables are generated by constexpr code, they end up in read-only
+// data and need no initialization at startup. Every square gets its own
+// attack table so that no single constant evaluation grows too large.
 namespace {
 
+using PORTABLE_ATTACK::RAY_DIRECTIONS;
+using RayTable = std::array<std::array<bitboard_t, SQ_COUNT>, 8>;
+
 constexpr bool isBoardEdge(square_t start)
 {
   return (BB(start) & ~BitboardUtil::NOT_EDGE) != 0;
@@ -17,120 +24,354 @@ constexpr bool isBoardEdge(square_t start)
 
 constexpr bool doesClip(square_t start, int dir)
 {
-  return !BitboardUtil::isOnBoard(start + dir) ||
-         (isBoardEdge(start) &&
-          std::abs(BitboardUtil::fileOf(start) -
-                   BitboardUtil::fileOf(start + dir)) > 1);
+  const int fileDistance = BitboardUtil::fileOf(start) -
+                           BitboardUtil::fileOf(square_t(start + dir));
+  return !BitboardUtil::isOnBoard(square_t(start + dir)) ||
+         (isBoardEdge(start) && (fileDistance > 1 || fileDistance < -1));
 }
 
-bitboard_t relevantBits(PieceType pt, square_t square)
+constexpr RayTable makeRays()
 {
-  assert(pt == BISHOP || pt == ROOK);
+  RayTable rays{};
+  for (int dir = 0; dir < 8; dir++)
+  {
+    const int step = RAY_DIRECTIONS[dir];
+    for (square_t square = SQ_A8; square <= SQ_H1; square++)
+    {
+      bitboard_t ray = 0ULL;
+      for (square_t tempSquare = square; !doesClip(tempSquare, step);)
+      {
+        tempSquare += step;
+        ray |= BB(tempSquare);
+      }
+      rays[dir][square] = ray;
+    }
+  }
+  return rays;
+}
 
-  std::array<int, 4> dirs = pt == BISHOP ? std::array<int, 4>{-7, -9, 7, 9}
-                                         : std::array<int, 4>{-1, 1, -8, 8};
+constexpr RayTable RAY_TABLE = makeRays();
 
-  bitboard_t board = 0ULL;
+// Ray directions 0, 1, 4 and 5 are orthogonal, the others diagonal
+constexpr bool movesAlong(PieceType pt, int dir)
+{
+  return ((dir & 2) == 0) == (pt == ROOK);
+}
 
-  for (const auto dir : dirs)
+constexpr bitboard_t relevantBits(PieceType pt, square_t square)
+{
+  bitboard_t board = 0ULL;
+  for (int dir = 0; dir < 8; dir++)
   {
-    auto tempSquare = square;
-    if (doesClip(tempSquare, dir))
+    const bitboard_t ray = RAY_TABLE[dir][square];
+    if (!movesAlong(pt, dir) || ray == 0)
     {
       continue;
     }
-
-    while (!doesClip(square_t(tempSquare + dir), dir))
-    {
-      tempSquare += dir;
-      board |= BB(tempSquare);
-    }
+    // The last square of a ray never blocks anything behind it
+    const bitboard_t last =
+        dir < 4 ? BB((63 - std::countl_zero(ray))) : ray & (~ray + 1);
+    board |= ray ^ last;
   }
   return board;
 }
 
-// Return the rooks attacks for the current occupancy and square
-bitboard_t slidingAttackSlow(PieceType pt, bitboard_t occupancy,
-                             square_t square)
+constexpr bitboard_t slidingAttack(PieceType pt, bitboard_t occupancy,
+                                   square_t square)
 {
-  std::array<int, 4> dirs = pt == BISHOP ? std::array<int, 4>{-7, -9, 7, 9}
-                                         : std::array<int, 4>{-1, 1, -8, 8};
   bitboard_t attack = 0ULL;
-
-  for (const auto dir : dirs)
+  for (int dir = 0; dir < 8; dir++)
   {
-    square_t tempSquare = square;
-    if (doesClip(tempSquare, dir))
+    if (!movesAlong(pt, dir))
     {
       continue;
     }
-
-    do
+    const bitboard_t ray = RAY_TABLE[dir][square];
+    const bitboard_t blockers = ray & occupancy;
+    if (blockers == 0)
     {
-      tempSquare += dir;
-      attack |= BB(tempSquare);
-    } while (!doesClip(tempSquare, dir) && (occupancy & BB(tempSquare)) == 0);
+      attack |= ray;
+      continue;
+    }
+    const int blocker = dir < 4 ? std::countr_zero(blockers)
+                                : 63 - std::countl_zero(blockers);
+    attack |= ray ^ RAY_TABLE[dir][blocker];
   }
   return attack;
 }
 
-bitboard_t setOccupancy(bitboard_t relevantBits, int pextIndex)
+template <PieceType pt, square_t square>
+constexpr bitboard_t RELEVANT_BITS = relevantBits(pt, square);
+
+template <PieceType pt, square_t square>
+constexpr std::size_t TABLE_SIZE = std::size_t{1}
+                                   << std::popcount(RELEVANT_BITS<pt, square>);
+
+#ifdef PEXT_BACKEND
+template <PieceType pt, square_t square> constexpr auto makePextTable()
 {
+  constexpr bitboard_t relBits = RELEVANT_BITS<pt, square>;
+  std::array<bitboard_t, TABLE_SIZE<pt, square>> table{};
+
+  // Walks the subsets of the relevant bits in increasing order, which is the
+  // order of their pext indices
   bitboard_t occupancy = 0ULL;
-  while (pextIndex != 0)
+  for (auto &attack : table)
   {
-    const auto sq = BitboardUtil::bitScan(relevantBits);
-    relevantBits &= relevantBits - 1;
-    occupancy |= (pextIndex & 1) * BB(sq);
-    pextIndex >>= 1;
+    attack = slidingAttack(pt, occupancy, square);
+    occupancy = (occupancy - relBits) & relBits;
   }
-  return occupancy;
+  return table;
 }
 
-// Storage area for rook- and bishop attacks
-bitboard_t RookArena[102400];
-bitboard_t BishopArena[5248];
+template <PieceType pt, square_t square>
+constexpr auto PEXT_TABLE = makePextTable<pt, square>();
 
-void init_attack_table(PieceType pt, bitboard_t table[],
-                       PEXT_ATTACK::Magic attacks[][2])
+template <std::size_t... squares>
+constexpr auto makePextMagics(std::index_sequence<squares...>)
 {
-  int size = 0;
-  for (square_t square = SQ_A8; square <= SQ_H1; square++)
+  return std::array<std::array<PEXT_ATTACK::Magic, 2>, SQ_COUNT>{
+      {{{{RELEVANT_BITS<BISHOP, squares>,
+          PEXT_TABLE<BISHOP, squares>.data()},
+         {RELEVANT_BITS<ROOK, squares>,
+          PEXT_TABLE<ROOK, squares>.data()}}}...}};
+}
+
+// Software pext, gathers the mask bits of the attack set into the low bits
+constexpr std::uint16_t compress(const bitboard_t attack, bitboard_t mask)
+{
+  std::uint16_t result = 0;
+  for (int bit = 0; mask != 0; mask &= mask - 1, bit++)
   {
-    PEXT_ATTACK::Magic &m = attacks[square][pt - BISHOP];
+    if ((attack & mask & (~mask + 1)) != 0)
+    {
+      result |= static_cast<std::uint16_t>(1U << bit);
+    }
+  }
+  return result;
+}
 
-    m.relBits = relevantBits(pt, square);
-    const int bits = BitboardUtil::bitCount(m.relBits);
-    assert(bits < 13);
+template <PieceType pt, square_t square>
+constexpr bitboard_t ATTACK_MASK = slidingAttack(pt, 0ULL, square);
 
-    m.attacks = square == SQ_A8
-                    ? table
-                    : attacks[square - 1][pt - BISHOP].attacks + size;
-    size = 0; // Reset size for the new square
+template <PieceType pt, square_t square> constexpr auto makeCompressedTable()
+{
+  static_assert(std::popcount(ATTACK_MASK<pt, square>) <= 16,
+                "Attack sets do not fit in 16 bits");
+  constexpr bitboard_t relBits = RELEVANT_BITS<pt, square>;
+  std::array<std::uint16_t, TABLE_SIZE<pt, square>> table{};
 
-    int combinations = static_cast<int>(std::pow<int, int>(2, bits));
-    for (int i = 0; i < combinations; ++i)
-    {
-      bitboard_t occupancy = setOccupancy(m.relBits, i);
-      const bitboard_t attack = slidingAttackSlow(pt, occupancy, square);
-      m.attacks[i] = attack;
-      // Verify correct setup
-      assert(BitboardUtil::pext(occupancy, m.relBits) == i);
-    }
-    size = combinations;
+  bitboard_t occupancy = 0ULL;
+  for (auto &attack : table)
+  {
+    attack = compress(slidingAttack(pt, occupancy, square),
+                      ATTACK_MASK<pt, square>);
+    occupancy = (occupancy - relBits) & relBits;
   }
+  return table;
+}
+
+template <PieceType pt, square_t square>
+constexpr auto COMPRESSED_TABLE = makeCompressedTable<pt, square>();
+
+template <std::size_t... squares>
+constexpr auto makeCompressedMagics(std::index_sequence<squares...>)
+{
+  return std::array<std::array<PEXT_ATTACK::CompressedMagic, 2>, SQ_COUNT>{
+      {{{{RELEVANT_BITS<BISHOP, squares>, ATTACK_MASK<BISHOP, squares>,
+          COMPRESSED_TABLE<BISHOP, squares>.data()},
+         {RELEVANT_BITS<ROOK, squares>, ATTACK_MASK<ROOK, squares>,
+          COMPRESSED_TABLE<ROOK, squares>.data()}}}...}};
 }
+#endif
+
+// Magic multipliers found offline by a random search over sparse numbers,
+// one per square in SQ_A8..SQ_H1 order
+constexpr bitboard_t BishopMagics[SQ_COUNT] = {
+    0x10102002004A1420ULL, 0x8020040400584008ULL, 0x10510800811201C8ULL,
+    0x5204042080000088ULL, 0x2204106880000002ULL, 0x1401042004000000ULL,
+    0x0400880410042004ULL, 0x0028208200A02020ULL, 0x1500241990010E00ULL,
+    0x8001200182020A40ULL, 0x40004101030B0000ULL, 0x8002041042000100ULL,
+    0x4010011041020038ULL, 0x0000010421044000ULL, 0x1500210808020A00ULL,
+    0x8000088400880520ULL, 0x0405004010040100ULL, 0x1005823210040108ULL,
+    0x2708008102040011ULL, 0x4048200404009100ULL, 0x0018104101400024ULL,
+    0x0003000601190101ULL, 0x8004803108491000ULL, 0x8014241200820800ULL,
+    0x0006E080100C3040ULL, 0x0501044A11041800ULL, 0x9020300008004045ULL,
+    0x0894080000220040ULL, 0x1001010083104000ULL, 0x5004030040900080ULL,
+    0x000400422C012400ULL, 0x0002128698404812ULL, 0x1010108404900440ULL,
+    0x0928021182084100ULL, 0x2006080409020024ULL, 0x1010202020180080ULL,
+    0xA010008200202200ULL, 0x2098015100019004ULL, 0x0002041440810811ULL,
+    0x802A02020000B098ULL, 0x0009015090004060ULL, 0x4000821082081001ULL,
+    0x0100210040420800ULL, 0x0800004010488A00ULL, 0x2000081104004040ULL,
+    0x4C8E029015000082ULL, 0x0420340322224842ULL, 0x1298260043400210ULL,
+    0x0000822802400008ULL, 0x00008A0101600000ULL, 0x3040003412080021ULL,
+    0x3040290220884800ULL, 0x4A1500401041004AULL, 0x8010200282020781ULL,
+    0x0020203142209091ULL, 0x0070300600902110ULL, 0x0040808800B62048ULL,
+    0x0000810400C44420ULL, 0x00080400440C0441ULL, 0x8340080020840411ULL,
+    0x0000000104208200ULL, 0x0000800810D00080ULL, 0x0400530411080200ULL,
+    0x4040702400932244ULL,
+};
+
+constexpr bitboard_t RookMagics[SQ_COUNT] = {
+    0x1080004008801020ULL, 0x0840092002C03000ULL, 0x1900200010400900ULL,
+    0x0880100008000480ULL, 0x4200100420080200ULL, 0x8100020100080400ULL,
+    0x0200040110886200ULL, 0x0200008040220411ULL, 0x0404800084400220ULL,
+    0x0000401000402000ULL, 0x0086001081220440ULL, 0x0408800800100280ULL,
+    0x000A001201040820ULL, 0x8848800200840080ULL, 0x4001000100040200ULL,
+    0x0442000102105084ULL, 0x9080010020804100ULL, 0x0040404000201009ULL,
+    0x0000808010002009ULL, 0x2200090021D00100ULL, 0x0008008008040080ULL,
+    0x0004004002010040ULL, 0x0011040008015042ULL, 0x00000A0001768104ULL,
+    0x0000800080204009ULL, 0x2010004140002001ULL, 0x9800200280100080ULL,
+    0x1000100080080080ULL, 0x0442000A00049020ULL, 0x2100040080020080ULL,
+    0x0800120400900148ULL, 0x0010040A00128541ULL, 0x2800804000800030ULL,
+    0x1010002000400041ULL, 0x4000200011004100ULL, 0x0610008410800800ULL,
+    0x0400802402800800ULL, 0xC100020080800400ULL, 0x0002000802000401ULL,
+    0x0182085882000401ULL, 0x0220204000808000ULL, 0x2860100040024022ULL,
+    0x0001002004110040ULL, 0x99101042000A0020ULL, 0x0004080004008080ULL,
+    0x0010040002008080ULL, 0x2012004881020004ULL, 0x8300842444820011ULL,
+    0x0088403882010200ULL, 0x0820400080210100ULL, 0x0110910040A00300ULL,
+    0x0801100280080480ULL, 0x0242009008200600ULL, 0x1002000489500200ULL,
+    0x0040800200010080ULL, 0x0091800041000080ULL, 0x0000209300488001ULL,
+    0x04C1002414824001ULL, 0x020020000B001041ULL, 0x7000100004200901ULL,
+    0x8002002004100802ULL, 0x30010002084C0007ULL, 0x0888221800813004ULL,
+    0x4000002840840112ULL,
+};
+
+template <PieceType pt, square_t square> constexpr auto makeMagicTable()
+{
+  constexpr bitboard_t relBits = RELEVANT_BITS<pt, square>;
+  constexpr MAGIC_ATTACK::Magic m{
+      relBits, (pt == BISHOP ? BishopMagics : RookMagics)[square], nullptr,
+      static_cast<unsigned>(SQ_COUNT - std::popcount(relBits))};
+  std::array<bitboard_t, TABLE_SIZE<pt, square>> table{};
+
+  bitboard_t occupancy = 0ULL;
+  do
+  {
+    const bitboard_t attack = slidingAttack(pt, occupancy, square);
+    // Verify that the magic has no destructive collisions
+    assert(table[m.index(occupancy)] == 0 ||
+           table[m.index(occupancy)] == attack);
+    table[m.index(occupancy)] = attack;
+    occupancy = (occupancy - relBits) & relBits;
+  } while (occupancy != 0);
+  return table;
+}
+
+template <PieceType pt, square_t square>
+constexpr auto MAGIC_TABLE = makeMagicTable<pt, square>();
+
+template <PieceType pt, square_t square>
+constexpr MAGIC_ATTACK::Magic makeMagic()
+{
+  constexpr bitboard_t relBits = RELEVANT_BITS<pt, square>;
+  return {relBits, (pt == BISHOP ? BishopMagics : RookMagics)[square],
+          MAGIC_TABLE<pt, square>.data(),
+          static_cast<unsigned>(SQ_COUNT - std::popcount(relBits))};
+}
+
+template <std::size_t... squares>
+constexpr auto makeMagics(std::index_sequence<squares...>)
+{
+  return std::array<std::array<MAGIC_ATTACK::Magic, 2>, SQ_COUNT>{
+      {{{makeMagic<BISHOP, squares>(), makeMagic<ROOK, squares>()}}...}};
+}
+
+// Picks the backend once, before main runs
+SliderBackend ActiveBackend = ATTACKS::detectBackend();
 
 } // namespace
 
 namespace PEXT_ATTACK {
-alignas(64) Magic ATTACK_MAGICS[SQ_COUNT][2]; // One for bishop, one for rooks
+#ifdef PEXT_BACKEND
+alignas(64) constexpr std::array<std::array<Magic, 2>, SQ_COUNT>
+    ATTACK_MAGICS = makePextMagics(std::make_index_sequence<SQ_COUNT>());
+alignas(64) constexpr std::array<std::array<CompressedMagic, 2>, SQ_COUNT>
+    COMPRESSED_MAGICS =
+        makeCompressedMagics(std::make_index_sequence<SQ_COUNT>());
+#else
+// Never looked up, isSupported() rejects the pext backends
+constexpr std::array<std::array<Magic, 2>, SQ_COUNT> ATTACK_MAGICS{};
+constexpr std::array<std::array<CompressedMagic, 2>, SQ_COUNT>
+    COMPRESSED_MAGICS{};
+#endif
 
 } // namespace PEXT_ATTACK
 
-void ATTACKS::init()
+namespace MAGIC_ATTACK {
+alignas(64) constexpr std::array<std::array<Magic, 2>, SQ_COUNT>
+    ATTACK_MAGICS = makeMagics(std::make_index_sequence<SQ_COUNT>());
+
+} // namespace MAGIC_ATTACK
+
+namespace PORTABLE_ATTACK {
+alignas(64) constexpr RayTable RAYS = RAY_TABLE;
+
+} // namespace PORTABLE_ATTACK
+
+bool ATTACKS::isSupported(const SliderBackend backend)
+{
+  if (backend != SliderBackend::PEXT && backend != SliderBackend::PEXT_PDEP)
+  {
+    return true;
+  }
+#ifdef PEXT_BACKEND
+  // Also called by static initializers, before the CPU model is known
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("bmi2");
+#else
+  return false;
+#endif
+}
+
+SliderBackend ATTACKS::detectBackend()
 {
-  init_attack_table(BISHOP, BishopArena, PEXT_ATTACK::ATTACK_MAGICS);
-  init_attack_table(ROOK, RookArena, PEXT_ATTACK::ATTACK_MAGICS);
-  std::cout << "Attack init complete\n";
-}
\ No newline at end of file
+#ifdef PEXT_BACKEND
+  if (isSupported(SliderBackend::PEXT) && !__builtin_cpu_is("znver1") &&
+      !__builtin_cpu_is("znver2"))
+  {
+    return SliderBackend::PEXT;
+  }
+#endif
+  return SliderBackend::MAGIC;
+}
+
+SliderBackend ATTACKS::backend() { return ActiveBackend; }
+
+bool ATTACKS::setBackend(const SliderBackend backend)
+{
+  if (!isSupported(backend))
+  {
+    return false;
+  }
+  ActiveBackend = backend;
+  return true;
+}
+
+std::string_view ATTACKS::backendName(const SliderBackend backend)
+{
+  switch (backend)
+  {
+  case SliderBackend::PEXT:
+    return "pext";
+  case SliderBackend::PEXT_PDEP:
+    return "pext16";
+  case SliderBackend::MAGIC:
+    return "magic";
+  default:
+    return "portable";
+  }
+}
+
+bool ATTACKS::parseBackend(const std::string_view name, SliderBackend &backend)
+{
+  for (const auto candidate : SLIDER_BACKENDS)
+  {
+    if (name == backendName(candidate))
+    {
+      backend = candidate;
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,28 @@
+#include "compactPosition.h"
+#include "bitboardUtil.h"
+#include "position.h"
+#include "types.h"
+
+CompactPosition::CompactPosition(const Position &pos)
+    : m_planes{}, m_hashKey(pos.st()->hashKey), m_checkers(pos.checkers()),
+      m_pinnedMask(pos.pinnedMask()),
+      m_kings{pos.kingSquare<Side::WHITE>(), pos.kingSquare<Side::BLACK>()},
+      m_enPassant(pos.enPassant()),
+      m_castlingRights(pos.st()->castlingRights),
+      m_whiteToMove(pos.isWhiteToMove())
+{
+  const bitboard_t blackPieces = pos.pieces_s<Side::BLACK>();
+  for (bitboard_t pieces = pos.pieces<ALL_PIECES>(); pieces != 0;
+       pieces &= pieces - 1)
+  {
+    const square_t square = BitboardUtil::bitScan(pieces);
+    if (blackPieces & BB(square))
+    {
+      put<Side::BLACK>(pos.pieceOn(square), BB(square));
+    }
+    else
+    {
+      put<Side::WHITE>(pos.pieceOn(square), BB(square));
+    }
+  }
+}
@@ -1,8 +1,10 @@
 #include "moveGen.h"
 
-#include "attackPextV2.h"
 #include "attackRays.h"
+#include "attacks.h"
 #include "bitboardUtil.h"
+#include "compactPosition.h"
+#include "moveSerialize.h"
 #include "position.h"
 #include "types.h"
 
@@ -11,198 +13,224 @@
 
 namespace {
 
-/// @brief Generate all legal moves for a piece rook or queen.
+/// @brief Serializes target bitboards into a move list
+class MoveWriter final
+{
+public:
+  explicit MoveWriter(Move *moveList) : m_moveList(moveList) {}
+
+  /// @brief Adds a move from the square to every target
+  template <FlagsV2 flags = NO_FLAG>
+  void add(const square_t from, bitboard_t targets)
+  {
+#if defined(__x86_64__)
+    if (SERIALIZE::useVector(targets))
+    {
+      m_moveList = SERIALIZE::fromSquare(
+          m_moveList, Move::make<flags>(from, 0).getData(), targets);
+      return;
+    }
+#endif
+    for (; targets != 0; targets &= targets - 1)
+    {
+      *m_moveList++ = Move::make<flags>(from, BitboardUtil::bitScan(targets));
+    }
+  }
+
+  /// @brief Adds all four promotions from the square to every target
+  void addPromotions(const square_t from, bitboard_t targets)
+  {
+    for (; targets != 0; targets &= targets - 1)
+    {
+      m_moveList = Move::makePromotions(from, BitboardUtil::bitScan(targets),
+                                        m_moveList);
+    }
+  }
+
+  /// @brief Adds pawn moves where every target is reached from target - step
+  template <int step, FlagsV2 flags = NO_FLAG>
+  void addPawnMoves(bitboard_t targets)
+  {
+#if defined(__x86_64__)
+    if (SERIALIZE::useVector(targets))
+    {
+      m_moveList = SERIALIZE::pawnMoves(m_moveList, step, flags, targets);
+      return;
+    }
+#endif
+    for (; targets != 0; targets &= targets - 1)
+    {
+      const square_t to = BitboardUtil::bitScan(targets);
+      *m_moveList++ = Move::make<flags>(square_t(to - step), to);
+    }
+  }
+
+  template <int step> void addPawnPromotions(bitboard_t targets)
+  {
+    for (; targets != 0; targets &= targets - 1)
+    {
+      const square_t to = BitboardUtil::bitScan(targets);
+      m_moveList = Move::makePromotions(square_t(to - step), to, m_moveList);
+    }
+  }
+
+  Move *end() const { return m_moveList; }
+
+private:
+  Move *m_moveList;
+};
+
+/// @brief Counts target bitboards without serializing them, same interface as
+/// MoveWriter. Promotions count as four moves.
+class MoveCounter final
+{
+public:
+  template <FlagsV2 flags = NO_FLAG>
+  void add(const square_t /*from*/, const bitboard_t targets)
+  {
+    m_count += BitboardUtil::bitCount(targets);
+  }
+
+  void addPromotions(const square_t /*from*/, const bitboard_t targets)
+  {
+    m_count += 4U * BitboardUtil::bitCount(targets);
+  }
+
+  template <int step, FlagsV2 flags = NO_FLAG>
+  void addPawnMoves(const bitboard_t targets)
+  {
+    m_count += BitboardUtil::bitCount(targets);
+  }
+
+  template <int step> void addPawnPromotions(const bitboard_t targets)
+  {
+    m_count += 4U * BitboardUtil::bitCount(targets);
+  }
+
+  std::size_t count() const { return m_count; }
+
+private:
+  std::size_t m_count = 0;
+};
+
+/// @brief Attacks of a knight or a slider with the given backend
+template <PieceType pt, SliderBackend b>
+bitboard_t pieceAttacks(const bitboard_t occupancy, const square_t square)
+{
+  if constexpr (pt == KNIGHT)
+  {
+    return PseudoAttacks::KnightAttacks[square];
+  }
+  else
+  {
+    return ATTACKS::sliderAttacks<pt, b>(occupancy, square);
+  }
+}
+
+/// @brief Generate all legal moves for a knight, bishop, rook or queen.
 /// @param targetSQs is the bitboard of legal blocking squares when the king is
 /// in check or only captures
 /// @param pinnedPieces is the bitboard of pieces pinned in any way to the king
-template <Side s, PieceType pt>
-Move *generatePieceMoves(const Position &pos, Move *moveList,
-                         const bitboard_t targetSQs,
-                         const bitboard_t pinnedPieces)
+template <Side s, PieceType pt, MoveFilter filter, SliderBackend b,
+          class Emitter, class Pos>
+void generatePieceMoves(const Pos &pos, Emitter &emitter,
+                        const bitboard_t targetSQs,
+                        const bitboard_t pinnedPieces)
 {
 
   static_assert(pt != PAWN && pt != KING,
                 "Unsupported piece type in generatePieceMoves()");
 
-  const bitboard_t movers = pos.pieces<s, pt>();
+  // A pinned piece can never resolve a check
+  const bitboard_t movers = filter == MoveFilter::CHECK_EVASIONS
+                                ? pos.template pieces<s, pt>() & ~pinnedPieces
+                                : pos.template pieces<s, pt>();
   const bitboard_t pinnedMovers = movers & pinnedPieces;
   const bitboard_t nonPinnedMovers = movers & ~pinnedPieces;
-  const bitboard_t allPieces = pos.pieces<ALL_PIECES>();
+  const bitboard_t allPieces = pos.template pieces<ALL_PIECES>();
 
   // Non pinned pieces
   for (bitboard_t pieces = nonPinnedMovers; pieces != 0; pieces &= pieces - 1)
   {
     const square_t square = BitboardUtil::bitScan(pieces);
-
-    bitboard_t attack = MoveGen::attacks<pt>(allPieces, square) & targetSQs;
-
-    for (; attack != 0; attack &= attack - 1)
-    {
-      *moveList++ = Move::make(square, BitboardUtil::bitScan(attack));
-    }
+    emitter.add(square, pieceAttacks<pt, b>(allPieces, square) & targetSQs);
   }
 
-  // Pinned pieces
+  // Pinned pieces can only move along the pin ray
   for (bitboard_t pieces = pinnedMovers; pieces != 0; pieces &= pieces - 1)
   {
     const square_t square = BitboardUtil::bitScan(pieces);
-
-    bitboard_t attack = MoveGen::attacks<pt>(allPieces, square) & targetSQs &
-                        RayConstants::RayBB[square][pos.kingSquare<s>()];
-
-    for (; attack != 0; attack &= attack - 1)
-    {
-      *moveList++ = Move::make(square, BitboardUtil::bitScan(attack));
-    }
+    emitter.add(square,
+                pieceAttacks<pt, b>(allPieces, square) & targetSQs &
+                    RayConstants::lineBB(square, pos.template kingSquare<s>()));
   }
-  return moveList;
 }
 
-template <Side s, MoveFilter filter>
-Move *generatePawnMoves(const Position &pos, Move *moveList,
-                        const bitboard_t targetSQs,
-                        const bitboard_t pinnedPieces)
+template <Side s, MoveFilter filter, SliderBackend b, class Emitter,
+          class Pos>
+void generatePawnMoves(const Pos &pos, Emitter &emitter,
+                       const bitboard_t targetSQs,
+                       const bitboard_t pinnedPieces)
 {
   // Useful constants
   constexpr auto masks = BitboardUtil::bitboardMasks<s>();
   constexpr Side enemy = BitboardUtil::opposite<s>();
-  const bitboard_t pawns = pos.pieces<s, PAWN>();
+  // A pinned pawn can never resolve a check
+  const bitboard_t pawns = filter == MoveFilter::CHECK_EVASIONS
+                               ? pos.template pieces<s, PAWN>() & ~pinnedPieces
+                               : pos.template pieces<s, PAWN>();
   const bitboard_t pinnedPawns = pawns & pinnedPieces;
   const bitboard_t nonPinnedPawms = pawns & ~pinnedPieces;
-  const bitboard_t allPieces = pos.pieces<ALL_PIECES>();
-  const bitboard_t enemyPieces = pos.pieces_s<enemy>();
+  const bitboard_t allPieces = pos.template pieces<ALL_PIECES>();
+  const bitboard_t enemyPieces = pos.template pieces_s<enemy>();
+  const square_t kingSquare = pos.template kingSquare<s>();
 
   // Generate captures
   if constexpr (filter != MoveFilter::QUIETS)
   {
     // Generate legal non pinned capture moves
-    const bitboard_t nonPinnedCaptureRight =
-        BitboardUtil::shift<masks->UP_RIGHT>(
-            nonPinnedPawms & masks->NOT_RIGHT_COL & ~masks->PROMO_RANK) &
-        enemyPieces & targetSQs;
-    const bitboard_t nonPinnedCaptureLeft =
-        BitboardUtil::shift<masks->UP_LEFT>(
-            nonPinnedPawms & masks->NOT_LEFT_COL & ~masks->PROMO_RANK) &
-        enemyPieces & targetSQs;
-
-    for (bitboard_t captureRight = nonPinnedCaptureRight; captureRight != 0;
-         captureRight &= captureRight - 1)
-    {
-      const square_t square = BitboardUtil::bitScan(captureRight);
-      *moveList++ = Move::make(square + masks->DOWN_LEFT, square);
-    }
-
-    for (bitboard_t captureLeft = nonPinnedCaptureLeft; captureLeft != 0;
-         captureLeft &= captureLeft - 1)
-    {
-      const square_t square = BitboardUtil::bitScan(captureLeft);
-      *moveList++ = Move::make(square + masks->DOWN_RIGHT, square);
-    }
+    const bitboard_t nonPromoPawns = nonPinnedPawms & ~masks->PROMO_RANK;
+    emitter.template addPawnMoves<masks->UP_RIGHT>(
+        BitboardUtil::shift<masks->UP_RIGHT>(nonPromoPawns &
+                                             masks->NOT_RIGHT_COL) &
+        enemyPieces & targetSQs);
+    emitter.template addPawnMoves<masks->UP_LEFT>(
+        BitboardUtil::shift<masks->UP_LEFT>(nonPromoPawns &
+                                            masks->NOT_LEFT_COL) &
+        enemyPieces & targetSQs);
 
     // Promotion capture
     const bitboard_t promoNonPinnedPawns = nonPinnedPawms & masks->PROMO_RANK;
     if (promoNonPinnedPawns)
     {
-      const bitboard_t promoCaptureRight =
+      emitter.template addPawnPromotions<masks->UP_RIGHT>(
           BitboardUtil::shift<masks->UP_RIGHT>(promoNonPinnedPawns &
                                                masks->NOT_RIGHT_COL) &
-          enemyPieces & targetSQs;
-      const bitboard_t promoCaptureLeft =
+          enemyPieces & targetSQs);
+      emitter.template addPawnPromotions<masks->UP_LEFT>(
           BitboardUtil::shift<masks->UP_LEFT>(promoNonPinnedPawns &
                                               masks->NOT_LEFT_COL) &
-          enemyPieces & targetSQs;
-
-      for (bitboard_t captureRight = promoCaptureRight; captureRight != 0;
-           captureRight &= captureRight - 1)
-      {
-        const square_t square = BitboardUtil::bitScan(captureRight);
-        moveList =
-            Move::makePromotions(square + masks->DOWN_LEFT, square, moveList);
-      }
-
-      for (bitboard_t captureLeft = promoCaptureLeft; captureLeft != 0;
-           captureLeft &= captureLeft - 1)
-      {
-        const square_t square = BitboardUtil::bitScan(captureLeft);
-        moveList =
-            Move::makePromotions(square + masks->DOWN_RIGHT, square, moveList);
-      }
+          enemyPieces & targetSQs);
     }
 
-    // Generate legal captures for pinned pawns
-    if (pinnedPawns)
+    // Pinned pawns can only capture the pinner
+    for (bitboard_t pinned = pinnedPawns; pinned != 0; pinned &= pinned - 1)
     {
-      // Generate legal non pinned capture moves
-      const bitboard_t pinnedCaptureRight =
-          BitboardUtil::shift<masks->UP_RIGHT>(
-              pinnedPawns & masks->NOT_RIGHT_COL & ~masks->PROMO_RANK) &
-          enemyPieces & targetSQs;
-      const bitboard_t pinnedCaptureLeft =
-          BitboardUtil::shift<masks->UP_LEFT>(
-              pinnedPawns & masks->NOT_LEFT_COL & ~masks->PROMO_RANK) &
-          enemyPieces & targetSQs;
-      const square_t kingSquare = pos.kingSquare<s>();
-
-      for (bitboard_t captureRight = pinnedCaptureRight; captureRight != 0;
-           captureRight &= captureRight - 1)
+      const square_t from = BitboardUtil::bitScan(pinned);
+      const bitboard_t captures = MoveGen::attacks<s, PAWN>(0, from) &
+                                  enemyPieces & targetSQs &
+                                  RayConstants::lineBB(from, kingSquare);
+      if (BB(from) & masks->PROMO_RANK)
       {
-        const square_t square = BitboardUtil::bitScan(captureRight);
-        const square_t from = square + masks->DOWN_LEFT;
-        if (RayConstants::RayBB[from][kingSquare] & BB(square))
-        {
-          *moveList++ = Move::make(from, square);
-        }
+        emitter.addPromotions(from, captures);
       }
-
-      for (bitboard_t captureLeft = pinnedCaptureLeft; captureLeft != 0;
-           captureLeft &= captureLeft - 1)
+      else
       {
-        const square_t square = BitboardUtil::bitScan(captureLeft);
-        const square_t from = square + masks->DOWN_RIGHT;
-        if (RayConstants::RayBB[from][kingSquare] & BB(square))
-        {
-          *moveList++ = Move::make(from, square);
-        }
-      }
-
-      // Promotion capture
-      const bitboard_t promoPinnedPawns = pinnedPawns & masks->PROMO_RANK;
-      if (promoPinnedPawns)
-      {
-        const bitboard_t promoCaptureRight =
-            BitboardUtil::shift<masks->UP_RIGHT>(promoPinnedPawns &
-                                                 masks->NOT_RIGHT_COL) &
-            enemyPieces & targetSQs;
-        const bitboard_t promoCaptureLeft =
-            BitboardUtil::shift<masks->UP_LEFT>(promoPinnedPawns &
-                                                masks->NOT_LEFT_COL) &
-            enemyPieces & targetSQs;
-
-        for (bitboard_t captureRight = promoCaptureRight; captureRight != 0;
-             captureRight &= captureRight - 1)
-        {
-          const square_t square = BitboardUtil::bitScan(captureRight);
-          const square_t from = square + masks->DOWN_LEFT;
-          if (RayConstants::RayBB[from][kingSquare] & BB(square))
-          {
-            moveList = Move::makePromotions(from, square, moveList);
-          }
-        }
-
-        for (bitboard_t captureLeft = promoCaptureLeft; captureLeft != 0;
-             captureLeft &= captureLeft - 1)
-        {
-          const square_t square = BitboardUtil::bitScan(captureLeft);
-          const square_t from = square + masks->DOWN_RIGHT;
-          if (RayConstants::RayBB[from][kingSquare] & BB(square))
-          {
-            moveList = Move::makePromotions(from, square, moveList);
-          }
-        }
+        emitter.add(from, captures);
       }
     }
 
-    const square_t epSquare = pos.st()->enPassant;
+    const square_t epSquare = pos.enPassant();
     const bool isEpLegal = targetSQs & BB((epSquare + masks->DOWN));
     if (epSquare != SQ_NONE && isEpLegal)
     {
@@ -219,25 +247,46 @@ Move *generatePawnMoves(const Position &pos, Move *moveList,
 
       if (epCaptureRight != 0 &&
           ((epCaptureRight & pinnedPawns) == 0 ||
-           (RayConstants::RayBB[fromRight][pos.kingSquare<s>()] & epBB) != 0) &&
-          !pos.isSpecialEnPassantKingPin<s>(epCaptureRight, masks))
+           (RayConstants::lineBB(fromRight, kingSquare) & epBB) != 0) &&
+          !pos.template isSpecialEnPassantKingPin<s, b>(epCaptureRight, masks))
       {
-        *moveList++ = Move::make<EN_PASSANT>(fromRight, epSquare);
+        emitter.template add<EN_PASSANT>(fromRight, epBB);
       }
 
       if (epCaptureLeft != 0 &&
           ((epCaptureLeft & pinnedPawns) == 0 ||
-           (RayConstants::RayBB[fromLeft][pos.kingSquare<s>()] & epBB) != 0) &&
-          !pos.isSpecialEnPassantKingPin<s>(epCaptureLeft, masks))
+           (RayConstants::lineBB(fromLeft, kingSquare) & epBB) != 0) &&
+          !pos.template isSpecialEnPassantKingPin<s, b>(epCaptureLeft, masks))
       {
-        *moveList++ = Move::make<EN_PASSANT>(fromLeft, epSquare);
+        emitter.template add<EN_PASSANT>(fromLeft, epBB);
       }
     }
   }
 
+  // Promotion pushes are generated together with the captures
+  if constexpr (filter != MoveFilter::QUIETS)
+  {
+    const bitboard_t promoPawns = nonPinnedPawms & masks->PROMO_RANK;
+    if (promoPawns)
+    {
+      emitter.template addPawnPromotions<masks->UP>(
+          BitboardUtil::shift<masks->UP>(promoPawns) & ~allPieces & targetSQs);
+    }
+
+    // Pinned pawns can only push along a file pin
+    for (bitboard_t pinned = pinnedPawns & masks->PROMO_RANK; pinned != 0;
+         pinned &= pinned - 1)
+    {
+      const square_t from = BitboardUtil::bitScan(pinned);
+      emitter.addPromotions(from, BitboardUtil::shift<masks->UP>(BB(from)) &
+                                      ~allPieces & targetSQs &
+                                      RayConstants::lineBB(from, kingSquare));
+    }
+  }
+
   if constexpr (filter == MoveFilter::CAPTURES)
   {
-    return moveList;
+    return;
   }
 
   // Generate one step pushes and double pushes
@@ -251,199 +300,251 @@ Move *generatePawnMoves(const Position &pos, Move *moveList,
                                      masks->POTENTIAL_DOUBLE_PUSHERS) &
       ~allPieces & targetSQs;
 
-  for (bitboard_t squares = singlePush & targetSQs; squares != 0;
-       squares &= squares - 1)
-  {
-    const square_t square = BitboardUtil::bitScan(squares);
-    *moveList++ = Move::make(square_t(square + masks->DOWN), square);
-  }
+  emitter.template addPawnMoves<masks->UP>(singlePush & targetSQs);
+  emitter.template addPawnMoves<2 * masks->UP, DOUBLE_JUMP>(doublePush);
 
-  for (bitboard_t squares = doublePush; squares != 0; squares &= squares - 1)
+  // Pinned pawns can only push along a file pin
+  for (bitboard_t pinned = pinnedPawns & ~masks->PROMO_RANK; pinned != 0;
+       pinned &= pinned - 1)
   {
-    const square_t square = BitboardUtil::bitScan(squares);
-    *moveList++ = Move::make<DOUBLE_JUMP>(
-        square_t(square + masks->DOWN + masks->DOWN), square);
+    const square_t from = BitboardUtil::bitScan(pinned);
+    const bitboard_t pinRay = RayConstants::lineBB(from, kingSquare);
+    const bitboard_t push = BitboardUtil::shift<masks->UP>(BB(from)) &
+                            ~allPieces & targetSQs & pinRay;
+    emitter.add(from, push);
+    emitter.template add<DOUBLE_JUMP>(
+        from, BitboardUtil::shift<masks->UP>(push &
+                                             masks->POTENTIAL_DOUBLE_PUSHERS) &
+                  ~allPieces & targetSQs);
   }
+}
 
-  const bitboard_t promoPawns = nonPinnedPawms & masks->PROMO_RANK;
-  if (promoPawns)
-  {
-    const bitboard_t promoPush =
-        BitboardUtil::shift<masks->UP>(promoPawns) & ~allPieces & targetSQs;
-    for (bitboard_t squares = promoPush; squares != 0; squares &= squares - 1)
-    {
-      const square_t square = BitboardUtil::bitScan(squares);
-      moveList = Move::makePromotions(square_t(square + masks->DOWN), square,
-                                      moveList);
-    }
-  }
+/// @brief Every square the enemy attacks, with the king taken off the board
+/// so that it can not step back along the ray of a checking slider
+template <Side s, SliderBackend b, class Pos>
+bitboard_t kingDangerSquares(const Pos &pos)
+{
+  constexpr Side enemy = BitboardUtil::opposite<s>();
+  return pos.template attackedSquares<enemy, b>(
+      pos.template pieces<ALL_PIECES>() & ~BB(pos.template kingSquare<s>()));
+}
 
-  if (pinnedPawns)
-  {
-    // Generate one step pushes and double pushes for pinned pawns
-    // Pseudo legal single pawn pushes (pawn might be pinned)
-    const bitboard_t pinnedSinglePush =
-        BitboardUtil::shift<masks->UP>(pinnedPawns) & ~allPieces & targetSQs;
-    // Pseudo legal double pushes (pawn might be pinned)
-    const bitboard_t pinnedDoublePush =
-        BitboardUtil::shift<masks->UP>(pinnedSinglePush &
-                                       masks->POTENTIAL_DOUBLE_PUSHERS) &
-        ~allPieces & targetSQs;
-    const square_t kingSquare = pos.kingSquare<s>();
-
-    for (bitboard_t squares = pinnedSinglePush; squares != 0;
-         squares &= squares - 1)
-    {
-      const square_t square = BitboardUtil::bitScan(squares);
-      const square_t from = square + masks->DOWN;
-      if (RayConstants::RayBB[from][kingSquare] & BB(square))
-      {
-        *moveList++ = Move::make(square + masks->DOWN, square);
-      }
-    }
+/// @brief Generates the king steps to safe squares among the targets
+template <Side s, class Emitter, class Pos>
+void generateKingMoves(const Pos &pos, Emitter &emitter,
+                       const bitboard_t targetSQs, const bitboard_t dangerSQs)
+{
+  const square_t kingSquare = pos.template kingSquare<s>();
+  emitter.add(kingSquare, MoveGen::attacks<KING>(0, kingSquare) & targetSQs &
+                              ~dangerSQs);
+}
 
-    for (bitboard_t squares = pinnedDoublePush; squares != 0;
-         squares &= squares - 1)
-    {
-      const square_t square = BitboardUtil::bitScan(squares);
-      const square_t from = square + masks->DOWN;
-      if (RayConstants::RayBB[from][kingSquare] & BB(square))
-      {
-        *moveList++ =
-            Move::make<DOUBLE_JUMP>(square + masks->DOWN + masks->DOWN, square);
-      }
-    }
+/// @brief Generates the legal moves when the side to move is in check. Only
+/// the king may move out of a double check, otherwise the unpinned pieces may
+/// also capture the checker or block the checking ray.
+template <Side s, SliderBackend b, class Emitter, class Pos>
+void generateEvasions(const Pos &pos, Emitter &emitter)
+{
+  generateKingMoves<s>(pos, emitter, ~pos.template pieces_s<s>(),
+                       kingDangerSquares<s, b>(pos));
 
-    const bitboard_t promoPinnedPawns = pinnedPawns & masks->PROMO_RANK;
-    if (promoPinnedPawns)
-    {
-      const bitboard_t promoPinnedPush =
-          BitboardUtil::shift<masks->UP>(promoPinnedPawns) & ~allPieces &
-          targetSQs;
-      for (bitboard_t squares = promoPinnedPush; squares != 0;
-           squares &= squares - 1)
-      {
-        const square_t square = BitboardUtil::bitScan(squares);
-        const square_t from = square + masks->DOWN;
-        if (RayConstants::RayBB[from][kingSquare] & BB(square))
-        {
-          moveList = Move::makePromotions(from, square, moveList);
-        }
-      }
-    }
+  if (BitboardUtil::moreThanOne(pos.checkers()))
+  {
+    return;
   }
 
-  return moveList;
-}
-
-} // namespace
+  // The checker and the squares between it and the king
+  constexpr MoveFilter evasions = MoveFilter::CHECK_EVASIONS;
+  const bitboard_t targetSQs = pos.blockForKing();
+  const bitboard_t pinned = pos.pinnedMask();
 
-namespace MoveGen {
-
-template <MoveFilter filter> Move *generate(const Position &pos, Move *moveList)
-{
-  return pos.isWhiteToMove() ? generate<filter, Side::WHITE>(pos, moveList)
-                             : generate<filter, Side::BLACK>(pos, moveList);
+  generatePawnMoves<s, evasions, b>(pos, emitter, targetSQs, pinned);
+  generatePieceMoves<s, KNIGHT, evasions, b>(pos, emitter, targetSQs, pinned);
+  generatePieceMoves<s, BISHOP, evasions, b>(pos, emitter, targetSQs, pinned);
+  generatePieceMoves<s, ROOK, evasions, b>(pos, emitter, targetSQs, pinned);
+  generatePieceMoves<s, QUEEN, evasions, b>(pos, emitter, targetSQs, pinned);
 }
 
-template <MoveFilter filter, Side s>
-Move *generate(const Position &pos, Move *moveList)
+/// @brief Generates the legal moves of the side to move into the emitter. The
+/// full move list of a side in check comes from the evasion generator.
+template <MoveFilter filter, Side s, SliderBackend b, class Emitter,
+          class Pos>
+void generateMoves(const Pos &pos, Emitter &emitter)
 {
+  if (filter == MoveFilter::CHECK_EVASIONS ||
+      (filter == MoveFilter::ALL && pos.checkers() != 0))
+  {
+    generateEvasions<s, b>(pos, emitter);
+    return;
+  }
+
   // Constants
   constexpr Side enemy = BitboardUtil::opposite<s>();
   constexpr BitboardUtil::Masks const *masks = BitboardUtil::bitboardMasks<s>();
 
   // Useful information for check detection and pin detection
-  /// TODO: Remove king when checking where king can go
-  const bitboard_t allPieces = pos.pieces<ALL_PIECES>();
-  const bitboard_t enemyPieces = pos.pieces_s<enemy>();
-  const bitboard_t friendlyPieces = pos.pieces_s<s>();
-
-  /// TODO: Get the correct check evasions squares
-  constexpr bitboard_t partialFilter =
-      filter == MoveFilter::ALL        ? BitboardUtil::All_SQ
-      : filter == MoveFilter::CAPTURES ? enemyPieces
-      : filter == MoveFilter::QUIETS   ? ~enemyPieces
-                                       : 0;
+  const bitboard_t allPieces = pos.template pieces<ALL_PIECES>();
+  const bitboard_t enemyPieces = pos.template pieces_s<enemy>();
+  const bitboard_t friendlyPieces = pos.template pieces_s<s>();
+
+  // Squares the pieces may move to. Pawns apply the filter themselves since
+  // promotion pushes belong to the captures.
   const bitboard_t fullFilter =
-      partialFilter & ~friendlyPieces; // Can't capture own pieces
+      filter == MoveFilter::CAPTURES ? enemyPieces
+      : filter == MoveFilter::QUIETS ? ~allPieces
+                                     : ~friendlyPieces;
 
-  const square_t kingSquare = pos.kingSquare<s>();
-  const bitboard_t checkBoard =
-      pos.attackOn(kingSquare, allPieces) & enemyPieces;
+  const square_t kingSquare = pos.template kingSquare<s>();
+  const bitboard_t checkBoard = pos.checkers();
 
   if (!BitboardUtil::moreThanOne(checkBoard))
   {
     /// Maximum of one checker
-    bitboard_t pinned = 0;
-    const bitboard_t snipers =
-        enemyPieces &
-        ((attacks<ROOK>(0, kingSquare) & (pos.pieces<ROOK, QUEEN>())) |
-         (attacks<BISHOP>(0, kingSquare) & pos.pieces<BISHOP, QUEEN>()));
-    for (bitboard_t snips = snipers; snips != 0; snips &= snips - 1)
-    {
-      square_t sniper = BitboardUtil::bitScan(snips);
-      const bitboard_t blockers =
-          RayConstants::betweenBB(sniper, kingSquare) & allPieces;
-      if (BitboardUtil::bitCount(blockers) == 1)
-      {
-        pinned |= blockers;
-      }
-    }
-
-    const bitboard_t checkFilter =
-        checkBoard == 0 ? BitboardUtil::All_SQ
-                        : RayConstants::betweenBB(
-                              BitboardUtil::bitScan(checkBoard), kingSquare) |
-                              checkBoard;
-    const bitboard_t targetSQs = fullFilter & checkFilter;
-
-    moveList = generatePawnMoves<s, filter>(pos, moveList, targetSQs, pinned);
-    moveList = generatePieceMoves<s, KNIGHT>(pos, moveList, targetSQs, pinned);
-    moveList = generatePieceMoves<s, BISHOP>(pos, moveList, targetSQs, pinned);
-    moveList = generatePieceMoves<s, ROOK>(pos, moveList, targetSQs, pinned);
-    moveList = generatePieceMoves<s, QUEEN>(pos, moveList, targetSQs, pinned);
+    const bitboard_t pinned = pos.pinnedMask();
+    const bitboard_t blockSQs = pos.blockForKing();
+    const bitboard_t targetSQs = fullFilter & blockSQs;
+
+    generatePawnMoves<s, filter, b>(pos, emitter, blockSQs, pinned);
+    generatePieceMoves<s, KNIGHT, filter, b>(pos, emitter, targetSQs, pinned);
+    generatePieceMoves<s, BISHOP, filter, b>(pos, emitter, targetSQs, pinned);
+    generatePieceMoves<s, ROOK, filter, b>(pos, emitter, targetSQs, pinned);
+    generatePieceMoves<s, QUEEN, filter, b>(pos, emitter, targetSQs, pinned);
   }
 
-  // King moves
-  bitboard_t kingStandard = attacks<KING>(0, kingSquare) & fullFilter;
-  const bitboard_t boardWithoutKing = allPieces & ~BB(kingSquare);
+  const bitboard_t dangerSQs = kingDangerSquares<s, b>(pos);
+  generateKingMoves<s>(pos, emitter, fullFilter, dangerSQs);
 
-  for (; kingStandard != 0; kingStandard &= kingStandard - 1)
-  {
-    square_t square = BitboardUtil::bitScan(kingStandard);
-    if ((pos.attackOn(square, boardWithoutKing) & enemyPieces) == 0)
-    {
-      *moveList++ = Move::make(kingSquare, square);
-    }
-  }
   if (filter == MoveFilter::CAPTURES || checkBoard)
   {
-    return moveList;
+    return;
   }
 
   // Castling king moves
   if (((masks->CASTLE_KING_PIECES & allPieces) == 0) &&
-      (pos.castleRights<s>() & 1) &&
-      (pos.isSafeSquares(masks->CASTLE_KING_ATTACK_SQUARES, allPieces,
-                         enemyPieces)))
+      (pos.template castleRights<s>() & 1) &&
+      ((masks->CASTLE_KING_ATTACK_SQUARES & dangerSQs) == 0))
   {
-    *moveList++ = Move::make<CASTLE>(kingSquare, kingSquare + 2);
+    emitter.template add<CASTLE>(kingSquare, BB((kingSquare + 2)));
   }
 
   // Castling queen side
   if (((masks->CASTLE_QUEEN_PIECES & allPieces) == 0) &&
-      (pos.castleRights<s>() & 2) &&
-      (pos.isSafeSquares(masks->CASTLE_QUEEN_ATTACK_SQUARES, allPieces,
-                         enemyPieces)))
+      (pos.template castleRights<s>() & 2) &&
+      ((masks->CASTLE_QUEEN_ATTACK_SQUARES & dangerSQs) == 0))
+  {
+    emitter.template add<CASTLE>(kingSquare, BB((kingSquare - 2)));
+  }
+}
+
+} // namespace
+
+namespace MoveGen {
+
+template <MoveFilter filter> Move *generate(const Position &pos, Move *moveList)
+{
+  return pos.isWhiteToMove() ? generate<filter, Side::WHITE>(pos, moveList)
+                             : generate<filter, Side::BLACK>(pos, moveList);
+}
+
+template <MoveFilter filter, Side s>
+Move *generate(const Position &pos, Move *moveList)
+{
+  switch (ATTACKS::backend())
+  {
+  case SliderBackend::PEXT:
+    return generate<filter, s, SliderBackend::PEXT>(pos, moveList);
+  case SliderBackend::PEXT_PDEP:
+    return generate<filter, s, SliderBackend::PEXT_PDEP>(pos, moveList);
+  case SliderBackend::MAGIC:
+    return generate<filter, s, SliderBackend::MAGIC>(pos, moveList);
+  default:
+    return generate<filter, s, SliderBackend::PORTABLE>(pos, moveList);
+  }
+}
+
+template <MoveFilter filter, Side s, SliderBackend b>
+Move *generate(const Position &pos, Move *moveList)
+{
+  MoveWriter writer(moveList);
+  generateMoves<filter, s, b>(pos, writer);
+  return writer.end();
+}
+
+template <MoveFilter filter> std::size_t count(const Position &pos)
+{
+  return pos.isWhiteToMove() ? count<filter, Side::WHITE>(pos)
+                             : count<filter, Side::BLACK>(pos);
+}
+
+template <MoveFilter filter, Side s> std::size_t count(const Position &pos)
+{
+  switch (ATTACKS::backend())
   {
-    *moveList++ = Move::make<CASTLE>(kingSquare, kingSquare - 2);
+  case SliderBackend::PEXT:
+    return count<filter, s, SliderBackend::PEXT>(pos);
+  case SliderBackend::PEXT_PDEP:
+    return count<filter, s, SliderBackend::PEXT_PDEP>(pos);
+  case SliderBackend::MAGIC:
+    return count<filter, s, SliderBackend::MAGIC>(pos);
+  default:
+    return count<filter, s, SliderBackend::PORTABLE>(pos);
   }
+}
 
-  return moveList;
+template <MoveFilter filter, Side s, SliderBackend b>
+std::size_t count(const Position &pos)
+{
+  MoveCounter counter;
+  generateMoves<filter, s, b>(pos, counter);
+  return counter.count();
+}
+
+template <MoveFilter filter, Side s, SliderBackend b>
+Move *generate(const CompactPosition &pos, Move *moveList)
+{
+  MoveWriter writer(moveList);
+  generateMoves<filter, s, b>(pos, writer);
+  return writer.end();
+}
+
+template <MoveFilter filter, Side s, SliderBackend b>
+std::size_t count(const CompactPosition &pos)
+{
+  MoveCounter counter;
+  generateMoves<filter, s, b>(pos, counter);
+  return counter.count();
 }
 
-template Move *generate<MoveFilter::ALL>(const Position &, Move *);
+// Every filter is instantiated for both sides, every slider backend and both
+// position layouts
+#define INSTANTIATE_BACKEND(filter, s, b)                                      \
+  template Move *generate<filter, s, b>(const Position &, Move *);             \
+  template std::size_t count<filter, s, b>(const Position &);                  \
+  template Move *generate<filter, s, b>(const CompactPosition &, Move *);      \
+  template std::size_t count<filter, s, b>(const CompactPosition &);
+
+#define INSTANTIATE_SIDE(filter, s)                                            \
+  template Move *generate<filter, s>(const Position &, Move *);                \
+  template std::size_t count<filter, s>(const Position &);                     \
+  INSTANTIATE_BACKEND(filter, s, SliderBackend::PEXT)                          \
+  INSTANTIATE_BACKEND(filter, s, SliderBackend::PEXT_PDEP)                     \
+  INSTANTIATE_BACKEND(filter, s, SliderBackend::MAGIC)                         \
+  INSTANTIATE_BACKEND(filter, s, SliderBackend::PORTABLE)
+
+#define INSTANTIATE_FILTER(filter)                                             \
+  template Move *generate<filter>(const Position &, Move *);                   \
+  template std::size_t count<filter>(const Position &);                        \
+  INSTANTIATE_SIDE(filter, Side::WHITE)                                        \
+  INSTANTIATE_SIDE(filter, Side::BLACK)
+
+INSTANTIATE_FILTER(MoveFilter::ALL)
+INSTANTIATE_FILTER(MoveFilter::CAPTURES)
+INSTANTIATE_FILTER(MoveFilter::QUIETS)
+INSTANTIATE_FILTER(MoveFilter::CHECK_EVASIONS)
+
+#undef INSTANTIATE_FILTER
+#undef INSTANTIATE_SIDE
+#undef INSTANTIATE_BACKEND
 
 // Template specializations for the attacks function
 template <>
@@ -462,19 +563,19 @@ bitboard_t attacks<KNIGHT>(const bitboard_t /*occupancy*/,
 template <>
 bitboard_t attacks<BISHOP>(const bitboard_t occupancy, const square_t square)
 {
-  return PEXT_ATTACK::ATTACK_MAGICS[square][0].attackBB(occupancy);
+  return ATTACKS::sliderAttacks<BISHOP>(occupancy, square);
 }
 
 template <>
 bitboard_t attacks<ROOK>(const bitboard_t occupancy, const square_t square)
 {
-  return PEXT_ATTACK::ATTACK_MAGICS[square][1].attackBB(occupancy);
+  return ATTACKS::sliderAttacks<ROOK>(occupancy, square);
 }
 
 template <>
 bitboard_t attacks<QUEEN>(const bitboard_t occupancy, const square_t square)
 {
-  return attacks<ROOK>(occupancy, square) | attacks<BISHOP>(occupancy, square);
+  return ATTACKS::sliderAttacks<QUEEN>(occupancy, square);
 }
 
 template <Side s, PieceType p>
@@ -1,5 +1,7 @@
 #include "moveOrdering.h"
 
+#include <algorithm>
+
 // void MoveOrder::moveSort(MoveList &move_list, const Position &, int)
 // {
 //   captureSort(move_list);
@@ -31,3 +33,182 @@
 
 //   return onlyFirstCapture || (bothCapture && capture1 > capture2);
 // }
+
+score_t MoveOrder::mvvLva(const Position &pos, const Move move)
+{
+  const FlagsV2 flags = move.getFlags();
+  const PieceType victim =
+      flags == EN_PASSANT ? PAWN : pos.pieceOn(move.getTo());
+  const PieceType attacker = pos.pieceOn(move.getFrom());
+  // The victim dominates, the cheapest attacker breaks ties
+  int score = 16 * PieceValues[victim] - PieceValues[attacker];
+  if (flags == PROMOTION)
+  {
+    score += PieceValues[KNIGHT + move.getPromo()] - PieceValues[PAWN];
+  }
+  return static_cast<score_t>(score);
+}
+
+MovePicker::MovePicker(const Position &pos, const Move ttMove,
+                       const Move *killers)
+    : m_pos(pos), m_stage(Stage::TT_MOVE), m_ttMove(ttMove)
+{
+  for (int i = 0; i < MoveOrder::NUM_KILLERS; i++)
+  {
+    m_killers[i] = killers != nullptr ? killers[i] : Move();
+    // Hand out every killer only once
+    for (int j = 0; j < i; j++)
+    {
+      if (m_killers[i].getData() == m_killers[j].getData())
+      {
+        m_killers[i] = Move();
+      }
+    }
+  }
+}
+
+Move MovePicker::next()
+{
+  switch (m_stage)
+  {
+  case Stage::TT_MOVE:
+    m_stage = Stage::GEN_CAPTURES;
+    if (isValid(m_ttMove))
+    {
+      return m_ttMove;
+    }
+    [[fallthrough]];
+
+  case Stage::GEN_CAPTURES:
+    generateCaptures();
+    m_stage = Stage::GOOD_CAPTURES;
+    [[fallthrough]];
+
+  case Stage::GOOD_CAPTURES:
+    while (m_cur < m_end)
+    {
+      const ScoredMove best = *pickBest(m_cur++, m_end);
+      if (best.move.getData() == m_ttMove.getData())
+      {
+        continue;
+      }
+      if (isGoodCapture(best.move))
+      {
+        return best.move;
+      }
+      // Slots before m_cur are consumed, keep the bad capture for later
+      *m_endBadCaptures++ = best;
+    }
+    m_stage = Stage::KILLERS;
+    [[fallthrough]];
+
+  case Stage::KILLERS:
+    while (m_killerIndex < MoveOrder::NUM_KILLERS)
+    {
+      const Move killer = m_killers[m_killerIndex++];
+      if (killer.getData() != m_ttMove.getData() && !isCaptureStage(killer) &&
+          isValid(killer))
+      {
+        return killer;
+      }
+    }
+    m_stage = Stage::GEN_QUIETS;
+    [[fallthrough]];
+
+  case Stage::GEN_QUIETS:
+    generateQuiets();
+    m_stage = Stage::QUIETS;
+    [[fallthrough]];
+
+  case Stage::QUIETS:
+    while (m_cur < m_end)
+    {
+      const Move move = (m_cur++)->move;
+      if (!isSpecial(move))
+      {
+        return move;
+      }
+    }
+    m_cur = m_moves;
+    m_stage = Stage::BAD_CAPTURES;
+    [[fallthrough]];
+
+  case Stage::BAD_CAPTURES:
+    if (m_cur < m_endBadCaptures)
+    {
+      return (m_cur++)->move;
+    }
+    m_stage = Stage::DONE;
+    [[fallthrough]];
+
+  case Stage::DONE:
+    break;
+  }
+  return Move();
+}
+
+bool MovePicker::isCaptureStage(const Move move) const
+{
+  const FlagsV2 flags = move.getFlags();
+  return flags == EN_PASSANT || flags == PROMOTION ||
+         m_pos.pieceOn(move.getTo()) != NO_PIECE;
+}
+
+/// @brief A capture is good when the exchange it starts does not lose material
+bool MovePicker::isGoodCapture(const Move move) const
+{
+  return m_pos.see(move, 0);
+}
+
+bool MovePicker::isSpecial(const Move move) const
+{
+  const move_t data = move.getData();
+  return data == m_ttMove.getData() ||
+         std::any_of(std::begin(m_killers), std::end(m_killers),
+                     [&](const Move killer) {
+                       return killer.getData() == data;
+                     });
+}
+
+/// @brief Hash moves and killers come from other positions, each is checked
+/// on its own without generating anything
+bool MovePicker::isValid(const Move move) const
+{
+  return move.getData() != 0 && m_pos.isPseudoLegal(move) &&
+         m_pos.isLegal(move);
+}
+
+/// @brief Captures and promotions go first
+void MovePicker::generateCaptures()
+{
+  Move moves[BitboardUtil::MAX_MOVES];
+  const Move *end = MoveGen::generate<MoveFilter::CAPTURES>(m_pos, moves);
+  m_cur = m_end = m_moves;
+  for (const Move *move = moves; move != end; move++)
+  {
+    *m_end++ = ScoredMove{*move, MoveOrder::mvvLva(m_pos, *move)};
+  }
+}
+
+/// @brief Quiets are placed after the bad captures
+void MovePicker::generateQuiets()
+{
+  Move moves[BitboardUtil::MAX_MOVES];
+  const Move *end = MoveGen::generate<MoveFilter::QUIETS>(m_pos, moves);
+  m_cur = m_end = m_endBadCaptures;
+  for (const Move *move = moves; move != end; move++)
+  {
+    *m_end++ = ScoredMove{*move, 0};
+  }
+}
+
+MovePicker::ScoredMove *MovePicker::pickBest(ScoredMove *begin,
+                                             ScoredMove *end)
+{
+  std::iter_swap(begin, std::max_element(begin, end,
+                                         [](const ScoredMove &lhs,
+                                            const ScoredMove &rhs) {
+                                           return lhs.score < rhs.score;
+                                         }));
+  return begin;
+}
@@ -0,0 +1,173 @@
+#include "moveSerialize.h"
+#include "bitboardUtil.h"
+#include "moveGen.h"
+#include "position.h"
+#include "types.h"
+
+#include <chrono>
+#include <iostream>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+#if defined(__x86_64__)
+
+// Squares 0-31 and 32-63 as 16 bit lanes, the to field of a move
+#define SQUARE_LANES(first)                                                    \
+  _mm512_set_epi16(first + 31, first + 30, first + 29, first + 28,             \
+                   first + 27, first + 26, first + 25, first + 24,             \
+                   first + 23, first + 22, first + 21, first + 20,             \
+                   first + 19, first + 18, first + 17, first + 16,             \
+                   first + 15, first + 14, first + 13, first + 12,             \
+                   first + 11, first + 10, first + 9, first + 8, first + 7,    \
+                   first + 6, first + 5, first + 4, first + 3, first + 2,      \
+                   first + 1, first)
+
+// A store starts at most at the 218th move of a list and writes 32 moves
+static_assert(BitboardUtil::MAX_MOVES >= 218 + 32,
+              "Move lists need room for a full register behind the last move");
+
+/// @brief Compresses the moves of the set lanes to the front and stores both
+/// halves, every store writes a full register behind the list end
+__attribute__((target("avx512f,avx512bw,avx512vbmi2"))) inline Move *
+compressStore(Move *moveList, const __m512i low, const __m512i high,
+              const bitboard_t targets)
+{
+  const auto lowMask = static_cast<__mmask32>(targets);
+  const auto highMask = static_cast<__mmask32>(targets >> 32U);
+  _mm512_storeu_si512(moveList, _mm512_maskz_compress_epi16(lowMask, low));
+  moveList += BitboardUtil::bitCount(targets & 0xFFFFFFFFULL);
+  _mm512_storeu_si512(moveList, _mm512_maskz_compress_epi16(highMask, high));
+  return moveList + BitboardUtil::bitCount(targets >> 32U);
+}
+
+// to | (to - step) << 6 | flags, lanes outside the targets are never stored
+__attribute__((target("avx512f,avx512bw,avx512vbmi2"))) inline __m512i
+pawnLanes(const __m512i to, const __m512i stepLanes, const __m512i flagLanes)
+{
+  return _mm512_or_si512(_mm512_or_si512(to, flagLanes),
+                         _mm512_slli_epi16(_mm512_sub_epi16(to, stepLanes), 6));
+}
+
+#endif
+
+SERIALIZE::Kernel detectKernel()
+{
+  return SERIALIZE::isSupported(SERIALIZE::Kernel::AVX512)
+             ? SERIALIZE::Kernel::AVX512
+             : SERIALIZE::Kernel::SCALAR;
+}
+
+// Picks the kernel once, before main runs
+SERIALIZE::Kernel ActiveKernel = detectKernel();
+
+} // namespace
+
+bool SERIALIZE::VectorActive = ActiveKernel == SERIALIZE::Kernel::AVX512;
+
+bool SERIALIZE::isSupported(const Kernel kernel)
+{
+  if (kernel == Kernel::SCALAR)
+  {
+    return true;
+  }
+#if defined(__x86_64__)
+  // Also called by static initializers, before the CPU model is known
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx512bw") &&
+         __builtin_cpu_supports("avx512vbmi2");
+#else
+  return false;
+#endif
+}
+
+SERIALIZE::Kernel SERIALIZE::kernel() { return ActiveKernel; }
+
+bool SERIALIZE::setKernel(const Kernel kernel)
+{
+  if (!isSupported(kernel))
+  {
+    return false;
+  }
+  ActiveKernel = kernel;
+  VectorActive = kernel == Kernel::AVX512;
+  return true;
+}
+
+std::string_view SERIALIZE::kernelName(const Kernel kernel)
+{
+  return kernel == Kernel::AVX512 ? "avx512" : "scalar";
+}
+
+#if defined(__x86_64__)
+
+__attribute__((target("avx512f,avx512bw,avx512vbmi2"))) Move *
+SERIALIZE::fromSquare(Move *moveList, const move_t base,
+                      const bitboard_t targets)
+{
+  const __m512i baseLanes = _mm512_set1_epi16(static_cast<short>(base));
+  return compressStore(moveList, _mm512_or_si512(SQUARE_LANES(0), baseLanes),
+                       _mm512_or_si512(SQUARE_LANES(32), baseLanes), targets);
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vbmi2"))) Move *
+SERIALIZE::pawnMoves(Move *moveList, const int step, const move_t flags,
+                     const bitboard_t targets)
+{
+  const __m512i stepLanes = _mm512_set1_epi16(static_cast<short>(step));
+  const __m512i flagLanes = _mm512_set1_epi16(static_cast<short>(flags));
+  return compressStore(moveList,
+                       pawnLanes(SQUARE_LANES(0), stepLanes, flagLanes),
+                       pawnLanes(SQUARE_LANES(32), stepLanes, flagLanes),
+                       targets);
+}
+
+#undef SQUARE_LANES
+
+#endif
+
+void SERIALIZE::bench()
+{
+  // Open middle games and the position with the most moves
+  constexpr const char *FENS[] = {
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -",
+      "r2q1rk1/pp2bppp/2n1bn2/3p4/3P4/2NBBN2/PP3PPP/R2Q1RK1 w - - 0 11",
+      "2r2rk1/1q2bppp/p2p1n2/1p1Pp3/4P3/1PN1BP2/1PQ3PP/R4RK1 b - - 0 19",
+      "R6R/3Q4/1Q4Q1/4Q3/2Q4Q/Q4Q2/pp1Q4/kBNN1KB1 w - - 0 1"};
+  constexpr int ROUNDS = 200000;
+
+  const Kernel active = kernel();
+  for (const auto benchKernel : {Kernel::SCALAR, Kernel::AVX512})
+  {
+    if (!setKernel(benchKernel))
+    {
+      continue;
+    }
+    std::size_t moves = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto *fen : FENS)
+    {
+      StateInfo st;
+      Position pos;
+      pos.fenInit(fen, st);
+      Move moveList[BitboardUtil::MAX_MOVES];
+      for (int round = 0; round < ROUNDS; round++)
+      {
+        moves += static_cast<std::size_t>(
+            MoveGen::generate<MoveFilter::ALL>(pos, moveList) - moveList);
+      }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const double ns =
+        static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                .count()) /
+        static_cast<double>(moves);
+    std::cout << "serialize " << kernelName(benchKernel) << ": " << ns
+              << " ns/move (" << moves << " moves)\n";
+  }
+  setKernel(active);
+}
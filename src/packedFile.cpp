@@ -0,0 +1,144 @@
+#include "packedFile.h"
+#include "GUI.h"
+#include "position.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr bool BIG_ENDIAN_HOST = std::endian::native == std::endian::big;
+
+/// @brief Swaps the multi byte fields between host and file order, the same
+/// swap goes both ways
+void swapBytes(PackedPosition &packed)
+{
+  packed.occupancy = __builtin_bswap64(packed.occupancy);
+  packed.rule50 = __builtin_bswap16(packed.rule50);
+  packed.fullMove = __builtin_bswap16(packed.fullMove);
+  packed.reserved = __builtin_bswap16(packed.reserved);
+}
+
+} // namespace
+
+namespace PACKED {
+
+Reader::Reader(const std::string &path) : m_file(path, std::ios::binary) {}
+
+std::size_t Reader::read(const std::span<PackedPosition> records)
+{
+  m_file.read(reinterpret_cast<char *>(records.data()),
+              static_cast<std::streamsize>(records.size_bytes()));
+  const std::size_t count =
+      static_cast<std::size_t>(m_file.gcount()) / sizeof(PackedPosition);
+  if constexpr (BIG_ENDIAN_HOST)
+  {
+    std::for_each(records.begin(), records.begin() + count, swapBytes);
+  }
+  return count;
+}
+
+Writer::Writer(const std::string &path)
+    : m_file(path, std::ios::binary | std::ios::trunc)
+{
+}
+
+bool Writer::write(const std::span<const PackedPosition> records)
+{
+  if constexpr (BIG_ENDIAN_HOST)
+  {
+    // Swapped in blocks to keep the writes large
+    PackedPosition block[256];
+    for (std::size_t first = 0; first < records.size(); first += 256)
+    {
+      const auto chunk = records.subspan(
+          first, std::min<std::size_t>(256, records.size() - first));
+      std::copy(chunk.begin(), chunk.end(), block);
+      std::for_each(block, block + chunk.size(), swapBytes);
+      m_file.write(reinterpret_cast<const char *>(block),
+                   static_cast<std::streamsize>(chunk.size_bytes()));
+    }
+    return m_file.good();
+  }
+  m_file.write(reinterpret_cast<const char *>(records.data()),
+               static_cast<std::streamsize>(records.size_bytes()));
+  return m_file.good();
+}
+
+bool Writer::write(const Position &pos)
+{
+  const PackedPosition packed = pos.encode();
+  return write(std::span(&packed, 1));
+}
+
+void bench()
+{
+  constexpr std::size_t COUNT = 1U << 20U;
+  constexpr std::size_t BLOCK = 4096;
+
+  std::vector<PackedPosition> records(COUNT);
+  std::size_t fenBytes = 0;
+  Position positions[std::size(GUI::BENCH_FENS)];
+  StateInfo states[std::size(GUI::BENCH_FENS)];
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < COUNT; i++)
+  {
+    const std::size_t index = i % std::size(GUI::BENCH_FENS);
+    positions[index].fenInit(GUI::BENCH_FENS[index], states[index]);
+    fenBytes += GUI::BENCH_FENS[index].size() + 1;
+  }
+  const auto parsed = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < COUNT; i++)
+  {
+    records[i] = positions[i % std::size(GUI::BENCH_FENS)].encode();
+  }
+  const auto encoded = std::chrono::steady_clock::now();
+
+  const std::string path =
+      (std::filesystem::temp_directory_path() / "explorer_packed.bin").string();
+  {
+    Writer writer(path);
+    if (!writer.isOpen() || !writer.write(records))
+    {
+      std::cout << "cannot write " << path << "\n";
+      return;
+    }
+  }
+
+  Position pos;
+  StateInfo st;
+  std::size_t decoded = 0;
+  const auto loadStart = std::chrono::steady_clock::now();
+  Reader reader(path);
+  PackedPosition block[BLOCK];
+  for (std::size_t read = reader.read(block); read != 0;
+       read = reader.read(block))
+  {
+    for (std::size_t i = 0; i < read; i++)
+    {
+      decoded += pos.decode(block[i], st) ? 1 : 0;
+    }
+  }
+  const auto loadEnd = std::chrono::steady_clock::now();
+  std::remove(path.c_str());
+
+  const auto seconds = [](const auto duration) {
+    return std::chrono::duration<double>(duration).count();
+  };
+  const auto count = static_cast<double>(COUNT);
+  std::cout << "fen parse:     " << count / seconds(parsed - start) / 1e6
+            << " M positions/s, " << fenBytes << " bytes\n";
+  std::cout << "encode:        " << count / seconds(encoded - parsed) / 1e6
+            << " M positions/s\n";
+  std::cout << "read + decode: " << count / seconds(loadEnd - loadStart) / 1e6
+            << " M positions/s, " << COUNT * sizeof(PackedPosition)
+            << " bytes (" << decoded << " accepted)\n";
+}
+
+} // namespace PACKED
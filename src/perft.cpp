@@ -0,0 +1,379 @@
+#include "perft.h"
+#include "GUI.h"
+#include "bitboardUtil.h"
+#include "compactPosition.h"
+#include "moveGen.h"
+#include "moveStack.h"
+#include "perftTable.h"
+#include "position.h"
+#include "types.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+template <class Pos, Side s, bool hashed, SliderBackend b>
+std::uint64_t bulkCount(Pos &pos, int depth, MoveStack &stack,
+                        PerftTable *table);
+
+/// @brief Makes a move of a known kind, counts the subtree below it and takes
+/// it back, without dispatching on the move flags again
+template <Side s, MoveKind kind, bool hashed, SliderBackend b>
+std::uint64_t countChild(Position &pos, const Move move, const int depth,
+                         StateInfo &state, MoveStack &stack, PerftTable *table)
+{
+  constexpr Side enemy = BitboardUtil::opposite<s>();
+  pos.doMove<s, kind>(move, state);
+  const std::uint64_t count =
+      bulkCount<Position, enemy, hashed, b>(pos, depth, stack, table);
+  pos.undoMove<enemy, kind>(move);
+  return count;
+}
+
+/// @brief Counts the leaves below pos. Positions with the COPY_MAKE policy
+/// play every move on a copy, the others make and unmake on pos itself.
+template <class Pos, Side s, bool hashed, SliderBackend b>
+std::uint64_t bulkCount(Pos &pos, int depth, MoveStack &stack,
+                        PerftTable *table)
+{
+  if (depth == 1)
+  {
+    return MoveGen::count<MoveFilter::ALL, s, b>(pos);
+  }
+
+  bitboard_t key = 0;
+  std::uint64_t count = 0;
+  if constexpr (hashed)
+  {
+    key = pos.hashKey();
+    if (table->probe(key, depth, count))
+    {
+      return count;
+    }
+  }
+
+  MoveStack::Frame &frame = stack.push<MoveFilter::ALL, s, b>(pos);
+  if constexpr (Pos::COPY_MAKE)
+  {
+    constexpr Side enemy = BitboardUtil::opposite<s>();
+    for (const Move *move = frame.begin; move != frame.end; move++)
+    {
+      Pos child = pos;
+      child.template doMove<s>(*move);
+      count += bulkCount<Pos, enemy, hashed, b>(child, depth - 1, stack, table);
+    }
+  }
+  else
+  {
+    for (const Move *move = frame.begin; move != frame.end; move++)
+    {
+      StateInfo &st = frame.state;
+      switch (pos.moveKind(*move))
+      {
+      case MoveKind::QUIET:
+        count += countChild<s, MoveKind::QUIET, hashed, b>(
+            pos, *move, depth - 1, st, stack, table);
+        break;
+      case MoveKind::CAPTURE:
+        count += countChild<s, MoveKind::CAPTURE, hashed, b>(
+            pos, *move, depth - 1, st, stack, table);
+        break;
+      case MoveKind::DOUBLE_PUSH:
+        count += countChild<s, MoveKind::DOUBLE_PUSH, hashed, b>(
+            pos, *move, depth - 1, st, stack, table);
+        break;
+      case MoveKind::EN_PASSANT:
+        count += countChild<s, MoveKind::EN_PASSANT, hashed, b>(
+            pos, *move, depth - 1, st, stack, table);
+        break;
+      case MoveKind::CASTLE:
+        count += countChild<s, MoveKind::CASTLE, hashed, b>(
+            pos, *move, depth - 1, st, stack, table);
+        break;
+      default:
+        count += countChild<s, MoveKind::PROMOTION, hashed, b>(
+            pos, *move, depth - 1, st, stack, table);
+        break;
+      }
+    }
+  }
+  stack.pop();
+
+  if constexpr (hashed)
+  {
+    table->store(key, depth, count);
+  }
+  return count;
+}
+
+template <class Pos, SliderBackend b>
+std::uint64_t countSubtree(Pos &pos, const int depth, MoveStack &stack,
+                           PerftTable *table)
+{
+  if (table != nullptr)
+  {
+    return pos.isWhiteToMove()
+               ? bulkCount<Pos, Side::WHITE, true, b>(pos, depth, stack, table)
+               : bulkCount<Pos, Side::BLACK, true, b>(pos, depth, stack, table);
+  }
+  return pos.isWhiteToMove()
+             ? bulkCount<Pos, Side::WHITE, false, b>(pos, depth, stack, table)
+             : bulkCount<Pos, Side::BLACK, false, b>(pos, depth, stack, table);
+}
+
+/// @brief Counts the subtree with the perft loop instantiated for the active
+/// slider backend
+template <class Pos>
+std::uint64_t countSubtree(Pos &pos, const int depth, MoveStack &stack,
+                           PerftTable *table)
+{
+  switch (ATTACKS::backend())
+  {
+  case SliderBackend::PEXT:
+    return countSubtree<Pos, SliderBackend::PEXT>(pos, depth, stack, table);
+  case SliderBackend::PEXT_PDEP:
+    return countSubtree<Pos, SliderBackend::PEXT_PDEP>(pos, depth, stack,
+                                                       table);
+  case SliderBackend::MAGIC:
+    return countSubtree<Pos, SliderBackend::MAGIC>(pos, depth, stack, table);
+  default:
+    return countSubtree<Pos, SliderBackend::PORTABLE>(pos, depth, stack, table);
+  }
+}
+
+/// @brief Counts the subtree in the given position mode, copy-make packs the
+/// position into a CompactPosition first
+std::uint64_t countSubtree(Position &pos, const int depth, MoveStack &stack,
+                           PerftTable *table, const Perft::PositionMode mode)
+{
+  if (mode == Perft::PositionMode::COPY_MAKE)
+  {
+    CompactPosition compact(pos);
+    return countSubtree(compact, depth, stack, table);
+  }
+  return countSubtree(pos, depth, stack, table);
+}
+
+struct BenchPosition final
+{
+  const char *fen;
+  int depth;
+};
+
+constexpr BenchPosition BENCH_POSITIONS[] = {
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 6},
+    {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -", 5},
+    {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - ", 6},
+    {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 5},
+    {"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", 5},
+    {"r3k2r/8/3Q4/8/8/5q2/8/R3K2R b KQkq - 0 1", 5},
+};
+
+/// @brief A subtree two plies below the root
+struct PerftTask final
+{
+  std::size_t rootIndex;
+  Move rootMove;
+  Move subMove;
+};
+
+/// @brief Task queue owned by one worker. The owner takes tasks from the
+/// front while idle workers steal from the back.
+class TaskQueue final
+{
+public:
+  void push(const PerftTask &task)
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(task);
+  }
+
+  bool pop(PerftTask &task)
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_tasks.empty())
+    {
+      return false;
+    }
+    task = m_tasks.front();
+    m_tasks.pop_front();
+    return true;
+  }
+
+  bool steal(PerftTask &task)
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_tasks.empty())
+    {
+      return false;
+    }
+    task = m_tasks.back();
+    m_tasks.pop_back();
+    return true;
+  }
+
+private:
+  std::mutex m_mutex;
+  std::deque<PerftTask> m_tasks;
+};
+
+void perftWorker(const Position &root, const int depth, const std::size_t id,
+                 PerftTable *table, const Perft::PositionMode mode,
+                 std::vector<TaskQueue> &queues,
+                 std::vector<std::atomic<std::uint64_t>> &rootCounts)
+{
+  // Every worker owns its position and the move and state stack below the
+  // root
+  StateInfo rootState;
+  StateInfo rootMoveState;
+  StateInfo subMoveState;
+  Position pos;
+  pos.copyFrom(root, rootState);
+  MoveStack stack;
+
+  const std::size_t numQueues = queues.size();
+  PerftTask task{0, Move(), Move()};
+  while (true)
+  {
+    bool found = queues[id].pop(task);
+    for (std::size_t i = 1; !found && i < numQueues; i++)
+    {
+      found = queues[(id + i) % numQueues].steal(task);
+    }
+    if (!found)
+    {
+      // All tasks are handed out up front, empty queues means we are done
+      return;
+    }
+
+    pos.doMove(task.rootMove, rootMoveState);
+    pos.doMove(task.subMove, subMoveState);
+    const std::uint64_t count =
+        countSubtree(pos, depth - 2, stack, table, mode);
+    pos.undoMove(task.subMove);
+    pos.undoMove(task.rootMove);
+
+    rootCounts[task.rootIndex].fetch_add(count, std::memory_order_relaxed);
+  }
+}
+
+} // namespace
+
+std::uint64_t Perft::perft(Position &pos, const int depth, PerftTable *table,
+                           const PositionMode mode)
+{
+  StateInfo state;
+  MoveStack stack;
+  std::uint64_t count = 0;
+  const bool leaf = depth <= 1;
+
+  for (const auto move : MoveGen::MoveList<MoveFilter::ALL>(pos))
+  {
+    pos.doMove(move, state);
+    auto part = leaf ? 1 : countSubtree(pos, depth - 1, stack, table, mode);
+    pos.undoMove(move);
+    count += part;
+    std::cout << GUI::makeMoveNotation(move) << ": " << part << "\n";
+  }
+
+  std::cout << "Total nodes visited: " << count << "\n";
+  return count;
+}
+
+std::uint64_t Perft::parallelPerft(const Position &pos, const int depth,
+                                   const int threads, PerftTable *table,
+                                   const PositionMode mode)
+{
+  StateInfo rootState;
+  Position root;
+  root.copyFrom(pos, rootState);
+
+  // Nothing to split below depth 3, the sub-root moves are the leaves
+  if (threads <= 1 || depth < 3)
+  {
+    return perft(root, depth, table, mode);
+  }
+
+  const MoveGen::MoveList<MoveFilter::ALL> rootMoves(root);
+  const auto numWorkers = static_cast<std::size_t>(threads);
+  std::vector<TaskQueue> queues(numWorkers);
+  std::vector<std::atomic<std::uint64_t>> rootCounts(rootMoves.size());
+
+  // Deal the sub-root subtrees round robin, neighbouring subtrees of the same
+  // root move end up on different workers
+  std::size_t dealt = 0;
+  StateInfo state;
+  for (std::size_t i = 0; i < rootMoves.size(); i++)
+  {
+    const Move rootMove = rootMoves.begin()[i];
+    root.doMove(rootMove, state);
+    for (const auto subMove : MoveGen::MoveList<MoveFilter::ALL>(root))
+    {
+      queues[dealt++ % numWorkers].push(PerftTask{i, rootMove, subMove});
+    }
+    root.undoMove(rootMove);
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(numWorkers);
+  for (std::size_t id = 0; id < numWorkers; id++)
+  {
+    workers.emplace_back(perftWorker, std::cref(root), depth, id, table, mode,
+                         std::ref(queues), std::ref(rootCounts));
+  }
+  std::for_each(workers.begin(), workers.end(),
+                [](std::thread &worker) { worker.join(); });
+
+  std::uint64_t count = 0;
+  for (std::size_t i = 0; i < rootMoves.size(); i++)
+  {
+    const std::uint64_t part = rootCounts[i].load(std::memory_order_relaxed);
+    count += part;
+    std::cout << GUI::makeMoveNotation(rootMoves.begin()[i]) << ": " << part
+              << "\n";
+  }
+
+  std::cout << "Total nodes visited: " << count << "\n";
+  return count;
+}
+
+std::uint64_t Perft::bench(const PositionMode mode)
+{
+  std::uint64_t totalNodes = 0;
+  std::uint64_t totalMs = 0;
+  MoveStack stack;
+
+  for (const auto &[fen, depth] : BENCH_POSITIONS)
+  {
+    StateInfo st;
+    Position pos;
+    pos.fenInit(fen, st);
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::uint64_t nodes = countSubtree(pos, depth, stack, nullptr, mode);
+    const auto end = std::chrono::steady_clock::now();
+    const auto ms = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(end - start)
+            .count());
+
+    totalNodes += nodes;
+    totalMs += ms;
+    std::cout << fen << " depth " << depth << ": " << nodes << " nodes, " << ms
+              << " ms\n";
+  }
+
+  std::cout << "Total nodes: " << totalNodes << "\n";
+  std::cout << "Position mode: "
+            << (mode == PositionMode::COPY_MAKE ? "copy-make" : "make/unmake")
+            << "\n";
+  std::cout << "Avg kN/s: " << totalNodes / std::max<std::uint64_t>(totalMs, 1)
+            << "\n";
+  return totalNodes;
+}
@@ -0,0 +1,59 @@
+#include "perftTable.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace {
+constexpr std::uint64_t DEPTH_MASK = 0xFFU;
+constexpr unsigned COUNT_SHIFT = 8U;
+} // namespace
+
+PerftTable::PerftTable(const std::size_t megaBytes) : m_megaBytes(megaBytes)
+{
+  // Round down to a power of two number of buckets so indexing is a mask
+  const std::size_t buckets =
+      std::bit_floor(std::max<std::size_t>(megaBytes * 1024 * 1024, 64) /
+                     sizeof(Bucket));
+  m_mask = buckets - 1;
+  m_buckets = std::make_unique<Bucket[]>(buckets);
+}
+
+bool PerftTable::probe(const bitboard_t key, const int depth,
+                       std::uint64_t &count) const
+{
+  for (const Entry &entry : bucket(key).entries)
+  {
+    const std::uint64_t data = entry.data.load(std::memory_order_relaxed);
+    const std::uint64_t keyXorData =
+        entry.keyXorData.load(std::memory_order_relaxed);
+    if ((keyXorData ^ data) == key &&
+        (data & DEPTH_MASK) == static_cast<std::uint64_t>(depth))
+    {
+      count = data >> COUNT_SHIFT;
+      return true;
+    }
+  }
+  return false;
+}
+
+void PerftTable::store(const bitboard_t key, const int depth,
+                       const std::uint64_t count)
+{
+  // Replace the shallowest entry, deep counts are the expensive ones
+  Bucket &slot = bucket(key);
+  Entry *replace = &slot.entries[0];
+  for (Entry &entry : slot.entries)
+  {
+    const std::uint64_t data = entry.data.load(std::memory_order_relaxed);
+    if ((data & DEPTH_MASK) <
+        (replace->data.load(std::memory_order_relaxed) & DEPTH_MASK))
+    {
+      replace = &entry;
+    }
+  }
+
+  const std::uint64_t data =
+      (count << COUNT_SHIFT) | static_cast<std::uint64_t>(depth);
+  replace->keyXorData.store(key ^ data, std::memory_order_relaxed);
+  replace->data.store(data, std::memory_order_relaxed);
+}
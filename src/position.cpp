@@ -3,17 +3,139 @@
 #include "bitboardUtil.h"
 #include "moveGen.h"
 #include "types.h"
+#include "zobristHash.h"
 
-#include <cctype>
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <cstring>
-#include <ios>
 #include <iostream>
-#include <sstream>
 #include <string_view>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
 namespace {
 constexpr std::string_view PieceIndexes(" PNBRQK pnbrqk");
 constexpr std::string_view CastlingIndexes("KQkq");
+
+/// @brief What a character of the fen board does. Pieces are coded as their
+/// type with the team in bit 3, digits and slashes store the empty code 0.
+struct FenSquare final
+{
+  std::uint8_t code;
+  std::uint8_t advance; // Squares the character covers
+  bool slash;
+  bool valid;
+};
+
+constexpr std::uint8_t BLACK_CODE = 8;
+
+constexpr std::array<FenSquare, 256> FenSquares = [] {
+  std::array<FenSquare, 256> squares{};
+  for (std::size_t id = 0; id < PieceIndexes.size(); id++)
+  {
+    if (PieceIndexes[id] != ' ')
+    {
+      squares[static_cast<unsigned char>(PieceIndexes[id])] = {
+          static_cast<std::uint8_t>(id % 7U + (id / 7U) * BLACK_CODE), 1,
+          false, true};
+    }
+  }
+  for (std::uint8_t empty = 1; empty <= 8; empty++)
+  {
+    squares['0' + empty] = {0, empty, false, true};
+  }
+  squares['/'] = {0, 0, true, true};
+  return squares;
+}();
+
+// Castling right by fen character, zero for anything else
+constexpr std::array<std::uint8_t, 256> CastlingBits = [] {
+  std::array<std::uint8_t, 256> bits{};
+  for (std::size_t id = 0; id < CastlingIndexes.size(); id++)
+  {
+    bits[static_cast<unsigned char>(CastlingIndexes[id])] =
+        static_cast<std::uint8_t>(1U << id);
+  }
+  return bits;
+}();
+
+// King and rook squares each castling right needs, in CastlingIndexes order
+constexpr square_t CastlingKings[4] = {SQ_E1, SQ_E1, SQ_E8, SQ_E8};
+constexpr square_t CastlingRooks[4] = {SQ_H1, SQ_A1, SQ_H8, SQ_A8};
+
+// Largest full move number whose ply still fits m_ply
+constexpr std::uint16_t MAX_FULL_MOVE = 32768;
+
+/// @brief Fields are separated by spaces, tabs and line ends, any control
+/// character counts as one
+constexpr bool isSpace(const char token)
+{
+  return static_cast<unsigned char>(token) <= ' ';
+}
+
+/// @brief The next field of a fen, empty at the end
+std::string_view nextField(const std::string_view fen, std::size_t &pos)
+{
+  while (pos < fen.size() && isSpace(fen[pos]))
+  {
+    pos++;
+  }
+  const std::size_t start = pos;
+  while (pos < fen.size() && !isSpace(fen[pos]))
+  {
+    pos++;
+  }
+  return fen.substr(start, pos - start);
+}
+
+/// @brief Reads a clock of up to five digits
+bool parseClock(const std::string_view field, std::uint16_t &clock)
+{
+  if (field.empty() || field.size() > 5)
+  {
+    return false;
+  }
+  std::uint32_t value = 0;
+  for (const char digit : field)
+  {
+    if (digit < '0' || digit > '9')
+    {
+      return false;
+    }
+    value = value * 10 + static_cast<std::uint32_t>(digit - '0');
+  }
+  clock = static_cast<std::uint16_t>(value);
+  return value <= UINT16_MAX;
+}
+
+/// @brief Whether team attacks the square, from bitboards that are not in a
+/// position yet
+bool isKingAttacked(const square_t square, const index_t team,
+                    const bitboard_t *pieceBoards, const bitboard_t *teamBoards,
+                    const square_t teamKing)
+{
+  constexpr SliderBackend b = SliderBackend::MAGIC;
+  const bitboard_t occupancy =
+      teamBoards[BitboardUtil::WHITE] | teamBoards[BitboardUtil::BLACK];
+  // A pawn of team attacks the square if a pawn of the other side on the
+  // square would attack it
+  const bitboard_t pawnAttacks =
+      team == BitboardUtil::WHITE
+          ? MoveGen::attacks<Side::BLACK, PAWN>(0, square)
+          : MoveGen::attacks<Side::WHITE, PAWN>(0, square);
+  const bitboard_t attackers =
+      (pawnAttacks & pieceBoards[PAWN]) |
+      (PseudoAttacks::KnightAttacks[square] & pieceBoards[KNIGHT]) |
+      (ATTACKS::sliderAttacks<ROOK, b>(occupancy, square) &
+       (pieceBoards[ROOK] | pieceBoards[QUEEN])) |
+      (ATTACKS::sliderAttacks<BISHOP, b>(occupancy, square) &
+       (pieceBoards[BISHOP] | pieceBoards[QUEEN])) |
+      (PseudoAttacks::KingAttacks[square] & BB(teamKing));
+  return (attackers & teamBoards[team]) != 0;
+}
 } // namespace
 
 void Position::doMove(Move move, StateInfo &newSt)
@@ -28,19 +150,27 @@ void Position::doMove(Move move, StateInfo &newSt)
   }
 }
 
-void Position::undoMove(Move move)
+template <Side s> void Position::doMove(Move move, StateInfo &newSt)
 {
-  if (m_whiteToMove)
+  switch (moveKind(move))
   {
-    undoMove<Side::WHITE>(move);
-  }
-  else
-  {
-    undoMove<Side::BLACK>(move);
+  case MoveKind::QUIET:
+    return doMove<s, MoveKind::QUIET>(move, newSt);
+  case MoveKind::CAPTURE:
+    return doMove<s, MoveKind::CAPTURE>(move, newSt);
+  case MoveKind::DOUBLE_PUSH:
+    return doMove<s, MoveKind::DOUBLE_PUSH>(move, newSt);
+  case MoveKind::EN_PASSANT:
+    return doMove<s, MoveKind::EN_PASSANT>(move, newSt);
+  case MoveKind::CASTLE:
+    return doMove<s, MoveKind::CASTLE>(move, newSt);
+  default:
+    return doMove<s, MoveKind::PROMOTION>(move, newSt);
   }
 }
 
-template <Side s> void Position::doMove(Move move, StateInfo &newSt)
+template <Side s, MoveKind kind>
+void Position::doMove(Move move, StateInfo &newSt)
 {
   static_assert(std::is_trivially_copyable_v<StateInfo>,
                 "Memcpy cannot be performed safely");
@@ -52,117 +182,196 @@ template <Side s> void Position::doMove(Move move, StateInfo &newSt)
   newSt.prevSt = m_st;
   m_st = &newSt;
 
+  // Only quiet moves and captures can be made by any piece
+  constexpr bool pawnMove = kind == MoveKind::DOUBLE_PUSH ||
+                            kind == MoveKind::EN_PASSANT ||
+                            kind == MoveKind::PROMOTION;
+  constexpr bool mayCapture =
+      kind == MoveKind::CAPTURE || kind == MoveKind::PROMOTION;
+
   // Get move info
   const square_t from = move.getFrom();
   const square_t to = move.getTo();
   const bitboard_t fromBB = BB(from);
   const bitboard_t toBB = BB(to);
 
-  const PieceType mover = m_board[from];
-  const PieceType captured = m_board[to];
-  const FlagsV2 flags = move.getFlags();
+  const PieceType mover = pawnMove                  ? PAWN
+                          : kind == MoveKind::CASTLE ? KING
+                                                     : m_board[from];
+  const PieceType captured = mayCapture ? m_board[to] : NO_PIECE;
 
   constexpr auto team = static_cast<index_t>(s);
   constexpr Side enemy = BitboardUtil::opposite<s>();
 
   constexpr const BitboardUtil::Masks *masks = BitboardUtil::bitboardMasks<s>();
 
-  m_teamBoards[team] ^= fromBB ^ toBB;
+  bitboard_t key = m_st->prevSt->hashKey ^ Zobrist::KEYS.blackToMove ^
+                   Zobrist::pieceKey<s>(mover, from) ^
+                   Zobrist::pieceKey<s>(mover, to);
+
+  // The board changes are collected as XOR masks and applied at the end, the
+  // same masks take the move back. Piece slot 0 is the mover, 1 whatever
+  // leaves its square (capture, en passant pawn or castling rook) and 2 the
+  // promotion piece. Unused square slots repeat the from square.
+  UndoDelta delta;
+  delta.pieceMasks = {0, 0, 0};
+  delta.pieceTypes = {NO_PIECE, NO_PIECE, NO_PIECE};
+  delta.teamMasks[team] = fromBB ^ toBB;
+  delta.teamMasks[team ^ 1U] = 0;
+  delta.squares = {from, to, from, from};
+  delta.pieces = {mover, captured, mover, mover};
+  delta.kings = {m_kings[0], m_kings[1]};
+
   m_st->capturedPiece = captured;
   m_board[to] = mover; // Will be overwritten if we have a promotion
 
+  // Captures and pawn moves reset the fifty move clock
+  if constexpr (kind == MoveKind::QUIET || kind == MoveKind::CASTLE)
+  {
+    m_st->rule50 =
+        mover == PAWN ? 0 : static_cast<std::uint16_t>(m_st->rule50 + 1);
+  }
+  else
+  {
+    m_st->rule50 = 0;
+  }
+
   // Remove ep possiblity
   if (m_st->enPassant != SQ_NONE)
   {
+    key ^= Zobrist::KEYS.enPassant[BitboardUtil::fileOf(m_st->enPassant)];
     m_st->enPassant = SQ_NONE;
   }
 
-  if (mover == PieceType::KING)
+  if constexpr (kind == MoveKind::CASTLE)
+  {
+    m_kings[team] = to;
+  }
+  else if constexpr (pawnMove)
+  {
+    delta.pieceTypes[0] = PAWN;
+    delta.pieceMasks[0] = fromBB ^ toBB;
+  }
+  else if (mover == PieceType::KING)
   {
     m_kings[team] = to;
   }
   else
   {
-    m_pieceBoards[mover] ^= fromBB ^ toBB;
+    delta.pieceTypes[0] = mover;
+    delta.pieceMasks[0] = fromBB ^ toBB;
   }
 
-  if (flags == NO_FLAG)
+  if constexpr (kind == MoveKind::DOUBLE_PUSH)
   {
-    if (move.isDoubleJump() && hasPawnsOnEpRank<enemy>())
+    if (hasPawnsOnEpRank<enemy>())
     {
       m_st->enPassant = static_cast<square_t>(to + masks->DOWN);
+      key ^= Zobrist::KEYS.enPassant[BitboardUtil::fileOf(to)];
     }
   }
-  else if (flags == CASTLE)
+  else if constexpr (kind == MoveKind::CASTLE)
   {
     if (toBB & masks->CASTLE_KING_PIECES)
     {
-      m_pieceBoards[ROOK] ^= masks->CASTLE_KING_ROOK_FROM_TO;
-      m_teamBoards[team] ^= masks->CASTLE_KING_ROOK_FROM_TO;
+      delta.pieceTypes[1] = ROOK;
+      delta.pieceMasks[1] = masks->CASTLE_KING_ROOK_FROM_TO;
+      delta.teamMasks[team] ^= masks->CASTLE_KING_ROOK_FROM_TO;
+      delta.squares[2] = masks->CASTLE_KING_ROOK_SOURCE;
+      delta.pieces[2] = ROOK;
+      delta.squares[3] = masks->CASTLE_KING_ROOK_DEST;
+      delta.pieces[3] = NO_PIECE;
       m_board[masks->CASTLE_KING_ROOK_SOURCE] = NO_PIECE;
       m_board[masks->CASTLE_KING_ROOK_DEST] = ROOK;
+      key ^= Zobrist::pieceKey<s>(ROOK, masks->CASTLE_KING_ROOK_SOURCE) ^
+             Zobrist::pieceKey<s>(ROOK, masks->CASTLE_KING_ROOK_DEST);
     }
     else
     {
-      m_pieceBoards[ROOK] ^= masks->CASTLE_QUEEN_ROOK_FROM_TO;
-      m_teamBoards[team] ^= masks->CASTLE_QUEEN_ROOK_FROM_TO;
+      delta.pieceTypes[1] = ROOK;
+      delta.pieceMasks[1] = masks->CASTLE_QUEEN_ROOK_FROM_TO;
+      delta.teamMasks[team] ^= masks->CASTLE_QUEEN_ROOK_FROM_TO;
+      delta.squares[2] = masks->CASTLE_QUEEN_ROOK_SOURCE;
+      delta.pieces[2] = ROOK;
+      delta.squares[3] = masks->CASTLE_QUEEN_ROOK_DEST;
+      delta.pieces[3] = NO_PIECE;
       m_board[masks->CASTLE_QUEEN_ROOK_SOURCE] = NO_PIECE;
       m_board[masks->CASTLE_QUEEN_ROOK_DEST] = ROOK;
+      key ^= Zobrist::pieceKey<s>(ROOK, masks->CASTLE_QUEEN_ROOK_SOURCE) ^
+             Zobrist::pieceKey<s>(ROOK, masks->CASTLE_QUEEN_ROOK_DEST);
     }
   }
-  else if (flags == EN_PASSANT)
+  else if constexpr (kind == MoveKind::EN_PASSANT)
   {
     const bitboard_t enemyPawnBB = BitboardUtil::shift<masks->DOWN>(toBB);
-    m_pieceBoards[PAWN] ^= enemyPawnBB;
-    m_teamBoards[team ^ 1U] ^= enemyPawnBB;
+    delta.pieceTypes[1] = PAWN;
+    delta.pieceMasks[1] = enemyPawnBB;
+    delta.teamMasks[team ^ 1U] = enemyPawnBB;
+    delta.squares[2] = static_cast<square_t>(to + masks->DOWN);
+    delta.pieces[2] = PAWN;
     m_board[to + masks->DOWN] = NO_PIECE;
+    key ^= Zobrist::pieceKey<enemy>(PAWN, to + masks->DOWN);
   }
-  else
-  { // Promotion
+  else if constexpr (kind == MoveKind::PROMOTION)
+  {
     const auto promoPiece = static_cast<PieceType>(KNIGHT + move.getPromo());
-    m_pieceBoards[PAWN] ^= toBB; // Remove pawn
-    m_pieceBoards[promoPiece] ^= toBB;
+    delta.pieceMasks[0] ^= toBB; // Remove pawn
+    delta.pieceTypes[2] = promoPiece;
+    delta.pieceMasks[2] = toBB;
     m_board[to] = promoPiece;
+    key ^= Zobrist::pieceKey<s>(PAWN, to) ^
+           Zobrist::pieceKey<s>(promoPiece, to);
   }
 
-  if (captured != NO_PIECE)
+  if constexpr (kind == MoveKind::CAPTURE)
   {
-    m_st->capturedPiece = captured;
-    m_pieceBoards[captured] ^= toBB;
-    m_teamBoards[team ^ 1U] ^= toBB;
+    delta.pieceTypes[1] = captured;
+    delta.pieceMasks[1] = toBB;
+    delta.teamMasks[team ^ 1U] = toBB;
+    key ^= Zobrist::pieceKey<enemy>(captured, to);
+  }
+  else if constexpr (kind == MoveKind::PROMOTION)
+  {
+    if (captured != NO_PIECE)
+    {
+      delta.pieceTypes[1] = captured;
+      delta.pieceMasks[1] = toBB;
+      delta.teamMasks[team ^ 1U] = toBB;
+      key ^= Zobrist::pieceKey<enemy>(captured, to);
+    }
   }
 
-  m_st->castlingRights &= BitboardUtil::castlingModifiers[from];
-  m_st->castlingRights &= BitboardUtil::castlingModifiers[to];
+  // Double pushes and en passant never touch a king or rook square
+  if constexpr (kind != MoveKind::DOUBLE_PUSH && kind != MoveKind::EN_PASSANT)
+  {
+    key ^= Zobrist::KEYS.castling[m_st->castlingRights];
+    m_st->castlingRights &= BitboardUtil::castlingModifiers[from];
+    m_st->castlingRights &= BitboardUtil::castlingModifiers[to];
+    key ^= Zobrist::KEYS.castling[m_st->castlingRights];
+  }
 
-  // Restore occupied
-  m_pieceBoards[ALL_PIECES] =
-      m_teamBoards[BitboardUtil::WHITE] | m_teamBoards[BitboardUtil::BLACK];
   m_board[from] = NO_PIECE;
 
-  m_whiteToMove = !m_whiteToMove;
-  // newHash ^= pos.ply * m_zobristHash.moveHash;
+  applyDelta(delta);
+  m_st->delta = delta;
 
+  m_whiteToMove = !m_whiteToMove;
   m_ply++;
-
-  // newHash ^= pos.ply * m_zobristHash.moveHash;
-
-  // pos.st.hashKey = newHash;
+  m_st->hashKey = key;
+  updateCheckInfo<enemy>();
 }
 
 /// @brief Takes back the move passed as argument.
 /// The move is assumed to be the last played move at this point.
 /// This function is called with the side that is currently to move,
 /// and therefor it is the opposite side move that is retracted.
-template <Side s> void Position::undoMove(Move move)
+template <Side s, MoveKind kind> void Position::undoMove(Move move)
 {
   const square_t from = move.getFrom();
   const square_t to = move.getTo();
-  const FlagsV2 flags = move.getFlags();
   const bitboard_t fromBB = BB(from);
   const bitboard_t toBB = BB(to);
   const PieceType mover = m_board[to];
-  const PieceType captured = m_st->capturedPiece;
   constexpr auto movingTeam = BitboardUtil::opposite<s>();
   constexpr auto teamIndex = static_cast<index_t>(movingTeam);
 
@@ -173,19 +382,29 @@ template <Side s> void Position::undoMove(Move move)
   m_board[from] = mover;
   m_board[to] = NO_PIECE; // Will be overwritten if we have a capture
 
-  if (mover == PieceType::KING)
+  if constexpr (kind == MoveKind::CASTLE)
   {
     m_kings[teamIndex] = from;
   }
-  else
+  else if constexpr (kind == MoveKind::DOUBLE_PUSH ||
+                     kind == MoveKind::EN_PASSANT)
+  {
+    m_pieceBoards[PAWN] ^= fromBB ^ toBB;
+  }
+  else if constexpr (kind == MoveKind::PROMOTION)
   {
     m_pieceBoards[mover] ^= fromBB ^ toBB;
   }
-
-  if (flags == NO_FLAG || move.isDoubleJump())
+  else if (mover == PieceType::KING)
   {
+    m_kings[teamIndex] = from;
   }
-  else if (flags == CASTLE)
+  else
+  {
+    m_pieceBoards[mover] ^= fromBB ^ toBB;
+  }
+
+  if constexpr (kind == MoveKind::CASTLE)
   {
     if (toBB & masks->CASTLE_KING_PIECES)
     {
@@ -202,26 +421,30 @@ template <Side s> void Position::undoMove(Move move)
       m_board[masks->CASTLE_QUEEN_ROOK_DEST] = NO_PIECE;
     }
   }
-  else if (flags == EN_PASSANT)
+  else if constexpr (kind == MoveKind::EN_PASSANT)
   {
     const bitboard_t realPawnBB = BB((to + masks->DOWN));
     m_pieceBoards[PAWN] ^= realPawnBB;
     m_teamBoards[teamIndex ^ 1U] ^= realPawnBB;
     m_board[to + masks->DOWN] = PAWN;
   }
-  else
-  { // Promotion
+  else if constexpr (kind == MoveKind::PROMOTION)
+  {
     // Turn the moved piece back to a pawn
     m_pieceBoards[KNIGHT + move.getPromo()] ^= fromBB;
     m_pieceBoards[PAWN] ^= fromBB;
     m_board[from] = PAWN;
   }
 
-  if (captured != NO_PIECE)
+  if constexpr (kind == MoveKind::CAPTURE || kind == MoveKind::PROMOTION)
   {
-    m_board[to] = captured;
-    m_teamBoards[teamIndex ^ 1U] ^= toBB;
-    m_pieceBoards[captured] ^= toBB;
+    const PieceType captured = m_st->capturedPiece;
+    if (kind == MoveKind::CAPTURE || captured != NO_PIECE)
+    {
+      m_board[to] = captured;
+      m_teamBoards[teamIndex ^ 1U] ^= toBB;
+      m_pieceBoards[captured] ^= toBB;
+    }
   }
 
   // Restore occupied
@@ -233,46 +456,418 @@ template <Side s> void Position::undoMove(Move move)
   m_st = m_st->prevSt; // Reset state
 }
 
-bitboard_t Position::attackOn(square_t square, bitboard_t board) const
+template <Side s> void Position::updateCheckInfo()
+{
+  const PositionAttacks::CheckInfo info = PositionAttacks::checkInfo<s>(*this);
+  m_st->checkers = info.checkers;
+  m_st->pinnedMask = info.pinnedMask;
+  m_st->blockForKing = info.blockForKing;
+  m_st->hasCheckSquares = false;
+}
+
+void Position::fillCheckSquares() const
 {
-  return (MoveGen::attacks<Side::WHITE, PAWN>(0, square) &
-          pieces<Side::BLACK, PAWN>()) |
-         (MoveGen::attacks<Side::BLACK, PAWN>(0, square) &
-          pieces<Side::WHITE, PAWN>()) |
-         (MoveGen::attacks<ROOK>(board, square) & pieces<ROOK, QUEEN>()) |
-         (MoveGen::attacks<BISHOP>(board, square) & pieces<BISHOP, QUEEN>()) |
-         (MoveGen::attacks<KNIGHT>(0, square) & pieces<KNIGHT>()) |
-         (MoveGen::attacks<KING>(0, square) & pieces<KING>());
+  m_whiteToMove ? fillCheckSquares<Side::WHITE>()
+                : fillCheckSquares<Side::BLACK>();
 }
 
-bool Position::isSafeSquares(bitboard_t squaresToCheck, const bitboard_t board,
-                             const bitboard_t attackers) const
+template <Side s> void Position::fillCheckSquares() const
 {
-  for (; squaresToCheck != 0; squaresToCheck &= squaresToCheck - 1)
+  switch (ATTACKS::backend())
   {
-    if ((attackOn(BitboardUtil::bitScan(squaresToCheck), board) & attackers) !=
-        0UL)
+  case SliderBackend::PEXT:
+    return fillCheckSquares<s, SliderBackend::PEXT>();
+  case SliderBackend::PEXT_PDEP:
+    return fillCheckSquares<s, SliderBackend::PEXT_PDEP>();
+  case SliderBackend::MAGIC:
+    return fillCheckSquares<s, SliderBackend::MAGIC>();
+  default:
+    return fillCheckSquares<s, SliderBackend::PORTABLE>();
+  }
+}
+
+template <Side s, SliderBackend b> void Position::fillCheckSquares() const
+{
+  const PositionAttacks::CheckSquares checks =
+      PositionAttacks::checkSquares<s, b>(*this);
+  m_st->checkSquares = checks.squares;
+  m_st->discoverers = checks.discoverers;
+  m_st->hasCheckSquares = true;
+}
+
+bool Position::see(const Move move, const int threshold) const
+{
+  switch (ATTACKS::backend())
+  {
+  case SliderBackend::PEXT:
+    return see<SliderBackend::PEXT>(move, threshold);
+  case SliderBackend::PEXT_PDEP:
+    return see<SliderBackend::PEXT_PDEP>(move, threshold);
+  case SliderBackend::MAGIC:
+    return see<SliderBackend::MAGIC>(move, threshold);
+  default:
+    return see<SliderBackend::PORTABLE>(move, threshold);
+  }
+}
+
+template <SliderBackend b>
+bool Position::see(const Move move, const int threshold) const
+{
+  const FlagsV2 flags = move.getFlags();
+  if (flags == CASTLE)
+  {
+    return threshold <= 0;
+  }
+  const square_t from = move.getFrom();
+  const square_t to = move.getTo();
+  const bitboard_t toBB = BB(to);
+  bitboard_t occupancy = m_pieceBoards[ALL_PIECES] ^ BB(from);
+
+  // The balance is the mover's gain less the threshold if the exchange
+  // stopped now, atRisk the value of the piece standing on the target
+  int balance = PieceValues[m_board[to]] - threshold;
+  int atRisk = PieceValues[m_board[from]];
+  if (flags == EN_PASSANT)
+  {
+    balance += PieceValues[PAWN];
+    occupancy ^= BB((m_whiteToMove ? to + 8 : to - 8));
+  }
+  else if (flags == PROMOTION)
+  {
+    const auto promo = static_cast<PieceType>(KNIGHT + move.getPromo());
+    balance += PieceValues[promo] - PieceValues[PAWN];
+    atRisk = PieceValues[promo];
+  }
+
+  // A pawn taking on the last rank promotes to a queen on the way
+  const bool promotes =
+      (toBB & (BitboardUtil::Rank1 | BitboardUtil::Rank8)) != 0;
+  bitboard_t attackers = attackOn<b>(to, occupancy);
+  const bitboard_t diagonal = pieces<BISHOP, QUEEN>();
+  const bitboard_t orthogonal = pieces<ROOK, QUEEN>();
+  index_t team = m_whiteToMove ? BitboardUtil::BLACK : BitboardUtil::WHITE;
+  bool ourTurn = false;
+
+  // Whoever stands below the threshold as it is captures, the other stops.
+  // The side that is short of attackers has lost.
+  while ((balance >= 0) != ourTurn)
+  {
+    attackers &= occupancy;
+    const bitboard_t ours = attackers & m_teamBoards[team];
+    if (ours == 0)
+    {
+      break;
+    }
+    PieceType attacker = PAWN;
+    while ((ours & (attacker == KING ? pieces<KING>()
+                                     : m_pieceBoards[attacker])) == 0)
+    {
+      attacker = static_cast<PieceType>(attacker + 1);
+    }
+    const bitboard_t pieceBB =
+        ours & (attacker == KING ? pieces<KING>() : m_pieceBoards[attacker]);
+    occupancy ^= pieceBB & (0 - pieceBB);
+
+    // Sliders lined up behind the attacker join in
+    if (attacker == PAWN || attacker == BISHOP || attacker >= QUEEN)
+    {
+      attackers |= ATTACKS::sliderAttacks<BISHOP, b>(occupancy, to) & diagonal;
+    }
+    if (attacker >= ROOK)
+    {
+      attackers |= ATTACKS::sliderAttacks<ROOK, b>(occupancy, to) & orthogonal;
+    }
+    // The king only takes a piece nobody defends
+    if (attacker == KING &&
+        (attackers & occupancy & m_teamBoards[team ^ 1U]) != 0)
+    {
+      break;
+    }
+
+    int captured = atRisk;
+    atRisk = PieceValues[attacker];
+    if (attacker == PAWN && promotes)
+    {
+      captured += PieceValues[QUEEN] - PieceValues[PAWN];
+      atRisk = PieceValues[QUEEN];
+    }
+    balance += ourTurn ? captured : -captured;
+    ourTurn = !ourTurn;
+    team ^= 1U;
+  }
+  return balance >= 0;
+}
+
+bool Position::givesCheck(const Move move) const
+{
+  return m_whiteToMove ? givesCheck<Side::WHITE>(move)
+                       : givesCheck<Side::BLACK>(move);
+}
+
+template <Side s> bool Position::givesCheck(const Move move) const
+{
+  switch (ATTACKS::backend())
+  {
+  case SliderBackend::PEXT:
+    return givesCheck<s, SliderBackend::PEXT>(move);
+  case SliderBackend::PEXT_PDEP:
+    return givesCheck<s, SliderBackend::PEXT_PDEP>(move);
+  case SliderBackend::MAGIC:
+    return givesCheck<s, SliderBackend::MAGIC>(move);
+  default:
+    return givesCheck<s, SliderBackend::PORTABLE>(move);
+  }
+}
+
+template <Side s, SliderBackend b>
+bool Position::givesCheck(const Move move) const
+{
+  constexpr Side enemy = BitboardUtil::opposite<s>();
+  constexpr const BitboardUtil::Masks *masks = BitboardUtil::bitboardMasks<s>();
+  const square_t from = move.getFrom();
+  const square_t to = move.getTo();
+  const bitboard_t fromBB = BB(from);
+  const bitboard_t toBB = BB(to);
+  const square_t kingSq = kingSquare<enemy>();
+  const PieceType mover = m_board[from];
+  const FlagsV2 flags = move.getFlags();
+  if (!m_st->hasCheckSquares)
+  {
+    fillCheckSquares<s, b>();
+  }
+
+  // The promoted piece is looked at below
+  if (mover != KING && flags != PROMOTION && (checkSquares(mover) & toBB) != 0)
+  {
+    return true;
+  }
+  // Uncovered, unless the piece stays on its line to the king
+  if ((m_st->discoverers & fromBB) != 0 &&
+      (RayConstants::lineBB(from, kingSq) & toBB) == 0)
+  {
+    return true;
+  }
+
+  switch (flags)
+  {
+  case PROMOTION:
+  {
+    // The pawn may have stood between the new piece and the king
+    const auto promo = static_cast<PieceType>(KNIGHT + move.getPromo());
+    const bitboard_t occupancy = m_pieceBoards[ALL_PIECES] ^ fromBB;
+    bitboard_t attacks = promo == KNIGHT ? MoveGen::attacks<KNIGHT>(0, to) : 0;
+    if (promo == BISHOP || promo == QUEEN)
+    {
+      attacks |= ATTACKS::sliderAttacks<BISHOP, b>(occupancy, to);
+    }
+    if (promo == ROOK || promo == QUEEN)
+    {
+      attacks |= ATTACKS::sliderAttacks<ROOK, b>(occupancy, to);
+    }
+    return (attacks & BB(kingSq)) != 0;
+  }
+  case EN_PASSANT:
+  {
+    // Two pawns leave their squares, either may uncover a slider
+    const auto pawnSquare = static_cast<square_t>(to + masks->DOWN);
+    const bitboard_t occupancy =
+        (m_pieceBoards[ALL_PIECES] ^ fromBB ^ BB(pawnSquare)) | toBB;
+    return ((ATTACKS::sliderAttacks<ROOK, b>(occupancy, kingSq) &
+             pieces<s, ROOK, QUEEN>()) |
+            (ATTACKS::sliderAttacks<BISHOP, b>(occupancy, kingSq) &
+             pieces<s, BISHOP, QUEEN>())) != 0;
+  }
+  case CASTLE:
+  {
+    const bool kingSide = (toBB & masks->CASTLE_KING_PIECES) != 0;
+    const square_t rookFrom = kingSide ? masks->CASTLE_KING_ROOK_SOURCE
+                                       : masks->CASTLE_QUEEN_ROOK_SOURCE;
+    const square_t rookTo = kingSide ? masks->CASTLE_KING_ROOK_DEST
+                                     : masks->CASTLE_QUEEN_ROOK_DEST;
+    const bitboard_t occupancy =
+        (m_pieceBoards[ALL_PIECES] ^ fromBB ^ BB(rookFrom)) | toBB |
+        BB(rookTo);
+    return (ATTACKS::sliderAttacks<ROOK, b>(occupancy, rookTo) &
+            BB(kingSq)) != 0;
+  }
+  default:
+    return false;
+  }
+}
+
+bool Position::isPseudoLegal(const Move move) const
+{
+  return m_whiteToMove ? isPseudoLegal<Side::WHITE>(move)
+                       : isPseudoLegal<Side::BLACK>(move);
+}
+
+template <Side s> bool Position::isPseudoLegal(const Move move) const
+{
+  switch (ATTACKS::backend())
+  {
+  case SliderBackend::PEXT:
+    return isPseudoLegal<s, SliderBackend::PEXT>(move);
+  case SliderBackend::PEXT_PDEP:
+    return isPseudoLegal<s, SliderBackend::PEXT_PDEP>(move);
+  case SliderBackend::MAGIC:
+    return isPseudoLegal<s, SliderBackend::MAGIC>(move);
+  default:
+    return isPseudoLegal<s, SliderBackend::PORTABLE>(move);
+  }
+}
+
+template <Side s, SliderBackend b>
+bool Position::isPseudoLegal(const Move move) const
+{
+  constexpr Side enemy = BitboardUtil::opposite<s>();
+  constexpr const BitboardUtil::Masks *masks = BitboardUtil::bitboardMasks<s>();
+  const square_t from = move.getFrom();
+  const square_t to = move.getTo();
+  const bitboard_t fromBB = BB(from);
+  const bitboard_t toBB = BB(to);
+  const bitboard_t allPieces = m_pieceBoards[ALL_PIECES];
+  const PieceType mover = m_board[from];
+  if ((pieces_s<s>() & fromBB) == 0 || (pieces_s<s>() & toBB) != 0)
+  {
+    return false;
+  }
+
+  const FlagsV2 flags = move.getFlags();
+  const bool doubleJump = move.isDoubleJump();
+  // The promotion bits carry nothing else
+  if (flags != PROMOTION && move.getPromo() != 0 && !doubleJump)
+  {
+    return false;
+  }
+  if (flags == CASTLE)
+  {
+    // The king on its square, the right kept and nothing in between
+    const bool kingSide = to == from + 2;
+    return mover == KING && from == (s == Side::WHITE ? SQ_E1 : SQ_E8) &&
+           (kingSide || to == from - 2) &&
+           (castleRights<s>() & (kingSide ? 1U : 2U)) != 0 &&
+           (allPieces & (kingSide ? masks->CASTLE_KING_PIECES
+                                  : masks->CASTLE_QUEEN_PIECES)) == 0;
+  }
+  if (mover != PAWN)
+  {
+    if (flags != NO_FLAG || doubleJump)
     {
       return false;
     }
+    switch (mover)
+    {
+    case KNIGHT:
+      return (MoveGen::attacks<KNIGHT>(0, from) & toBB) != 0;
+    case BISHOP:
+      return (ATTACKS::sliderAttacks<BISHOP, b>(allPieces, from) & toBB) != 0;
+    case ROOK:
+      return (ATTACKS::sliderAttacks<ROOK, b>(allPieces, from) & toBB) != 0;
+    case QUEEN:
+      return (ATTACKS::sliderAttacks<QUEEN, b>(allPieces, from) & toBB) != 0;
+    default:
+      return (PseudoAttacks::KingAttacks[from] & toBB) != 0;
+    }
   }
-  return true;
+
+  // Pawns promote exactly when they reach the last rank
+  if ((flags == PROMOTION) != ((masks->PROMO_RANK & fromBB) != 0))
+  {
+    return false;
+  }
+  const bool capture = (MoveGen::attacks<s, PAWN>(0, from) & toBB) != 0;
+  if (flags == EN_PASSANT)
+  {
+    return capture && to == m_st->enPassant;
+  }
+  if (doubleJump)
+  {
+    const auto over = static_cast<square_t>(from + masks->UP);
+    return to == from + 2 * masks->UP &&
+           (masks->POTENTIAL_DOUBLE_PUSHERS & BB(over)) != 0 &&
+           (allPieces & (BB(over) | toBB)) == 0;
+  }
+  return capture ? (pieces_s<enemy>() & toBB) != 0
+                 : to == from + masks->UP && (allPieces & toBB) == 0;
+}
+
+bool Position::isLegal(const Move move) const
+{
+  return m_whiteToMove ? isLegal<Side::WHITE>(move)
+                       : isLegal<Side::BLACK>(move);
 }
 
-template <Side s>
-bool Position::isSpecialEnPassantKingPin(const bitboard_t epPawn,
-                                         const BitboardUtil::Masks *masks) const
+template <Side s> bool Position::isLegal(const Move move) const
+{
+  switch (ATTACKS::backend())
+  {
+  case SliderBackend::PEXT:
+    return isLegal<s, SliderBackend::PEXT>(move);
+  case SliderBackend::PEXT_PDEP:
+    return isLegal<s, SliderBackend::PEXT_PDEP>(move);
+  case SliderBackend::MAGIC:
+    return isLegal<s, SliderBackend::MAGIC>(move);
+  default:
+    return isLegal<s, SliderBackend::PORTABLE>(move);
+  }
+}
+
+template <Side s, SliderBackend b>
+bool Position::isLegal(const Move move) const
 {
   constexpr Side enemy = BitboardUtil::opposite<s>();
-  const auto kingSq = kingSquare<s>();
-  const bitboard_t realPawn =
-      BB(static_cast<index_t>(m_st->enPassant + masks->DOWN));
-  const bitboard_t snipers = pieces<enemy, ROOK, QUEEN>();
-  return (BB(kingSq) & masks->EP_RANK) != 0 &&
-         (snipers & masks->EP_RANK) != 0 &&
-         (MoveGen::attacks<ROOK>(pieces<ALL_PIECES>() & ~(epPawn | realPawn),
-                                 kingSq) &
-          snipers) != 0;
+  constexpr const BitboardUtil::Masks *masks = BitboardUtil::bitboardMasks<s>();
+  const square_t from = move.getFrom();
+  const square_t to = move.getTo();
+  const bitboard_t fromBB = BB(from);
+  const bitboard_t toBB = BB(to);
+  const square_t kingSq = kingSquare<s>();
+  const bitboard_t enemies = pieces_s<enemy>();
+  const FlagsV2 flags = move.getFlags();
+
+  if (flags == CASTLE)
+  {
+    // Neither out of, through nor into check
+    if (checkers() != 0)
+    {
+      return false;
+    }
+    const int step = to > from ? 1 : -1;
+    for (int square = from + step; square != to + step; square += step)
+    {
+      if ((attackOn<b>(static_cast<square_t>(square), pieces<ALL_PIECES>()) &
+           enemies) != 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (from == kingSq)
+  {
+    // The king must not shadow the square from a slider checking it
+    return (attackOn<b>(to, pieces<ALL_PIECES>() ^ fromBB) & enemies) == 0;
+  }
+  if (BitboardUtil::moreThanOne(checkers()))
+  {
+    return false;
+  }
+  if (flags == EN_PASSANT)
+  {
+    // Only the pushed pawn is taken among the leapers, sliders are looked up
+    // from the king once both pawns have left
+    const auto pawnSquare = static_cast<square_t>(to + masks->DOWN);
+    const bitboard_t occupancy =
+        (pieces<ALL_PIECES>() ^ fromBB ^ BB(pawnSquare)) | toBB;
+    return (checkers() & pieces<PAWN, KNIGHT>() & ~BB(pawnSquare)) == 0 &&
+           ((ATTACKS::sliderAttacks<ROOK, b>(occupancy, kingSq) &
+             pieces<enemy, ROOK, QUEEN>()) |
+            (ATTACKS::sliderAttacks<BISHOP, b>(occupancy, kingSq) &
+             pieces<enemy, BISHOP, QUEEN>())) == 0;
+  }
+  return (blockForKing() & toBB) != 0 &&
+         ((pinnedMask() & fromBB) == 0 ||
+          (RayConstants::lineBB(from, kingSq) & toBB) != 0);
 }
 
 void Position::placePiece(PieceType piece, square_t square, const index_t team)
@@ -293,63 +888,432 @@ void Position::placePiece(PieceType piece, square_t square, const index_t team)
   m_pieceBoards[ALL_PIECES] |= BB(square);
 }
 
-/// @brief: Initialize the position according to the fen string
-/// @note: Assumes a well formatted fen string, will likely crash on
-/// illformatted strings
-void Position::fenInit(const std::string &fen, StateInfo &st)
+void Position::splitCodes(const std::uint8_t *codes, Setup &setup)
+{
+  std::fill(std::begin(setup.pieceBoards), std::end(setup.pieceBoards), 0);
+  bitboard_t blackPieces = 0;
+#if defined(__x86_64__) || defined(_M_X64)
+  // Sixteen squares per compare
+  const __m128i typeMask = _mm_set1_epi8(BLACK_CODE - 1);
+  for (std::size_t chunk = 0; chunk < SQ_COUNT; chunk += 16)
+  {
+    const __m128i squares =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(codes + chunk));
+    const __m128i types = _mm_and_si128(squares, typeMask);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(setup.board + chunk), types);
+    for (index_t piece = ALL_PIECES; piece <= KING; piece++)
+    {
+      const auto mask = static_cast<std::uint16_t>(_mm_movemask_epi8(
+          _mm_cmpeq_epi8(types, _mm_set1_epi8(static_cast<char>(piece)))));
+      setup.pieceBoards[piece] |= bitboard_t{mask} << chunk;
+    }
+    const auto black = static_cast<std::uint16_t>(
+        _mm_movemask_epi8(_mm_cmpgt_epi8(squares, typeMask)));
+    blackPieces |= bitboard_t{black} << chunk;
+  }
+#else
+  for (square_t square = 0; square < SQ_COUNT; square++)
+  {
+    const auto type = static_cast<PieceType>(codes[square] % BLACK_CODE);
+    setup.board[square] = type;
+    setup.pieceBoards[type] |= BB(square);
+    if (codes[square] >= BLACK_CODE)
+    {
+      blackPieces |= BB(square);
+    }
+  }
+#endif
+  // The empty code was collected in the occupancy slot
+  setup.pieceBoards[ALL_PIECES] = ~setup.pieceBoards[ALL_PIECES];
+  setup.teamBoards[BitboardUtil::WHITE] =
+      setup.pieceBoards[ALL_PIECES] & ~blackPieces;
+  setup.teamBoards[BitboardUtil::BLACK] = blackPieces;
+}
+
+bool Position::checkSetup(Setup &setup)
+{
+  const bitboard_t *pieceBoards = setup.pieceBoards;
+  const bitboard_t *teamBoards = setup.teamBoards;
+  const bitboard_t whiteKing =
+      pieceBoards[KING] & teamBoards[BitboardUtil::WHITE];
+  const bitboard_t blackKing =
+      pieceBoards[KING] & teamBoards[BitboardUtil::BLACK];
+  if (BitboardUtil::bitCount(whiteKing) != 1 ||
+      BitboardUtil::bitCount(blackKing) != 1 ||
+      BitboardUtil::bitCount(teamBoards[BitboardUtil::WHITE]) > 16 ||
+      BitboardUtil::bitCount(teamBoards[BitboardUtil::BLACK]) > 16 ||
+      (pieceBoards[PAWN] & (BitboardUtil::Rank1 | BitboardUtil::Rank8)) != 0 ||
+      setup.fullMove > MAX_FULL_MOVE)
+  {
+    return false;
+  }
+  const square_t *kings = setup.kings;
+  setup.kings[BitboardUtil::WHITE] = BitboardUtil::bitScan(whiteKing);
+  setup.kings[BitboardUtil::BLACK] = BitboardUtil::bitScan(blackKing);
+
+  // The side that just moved cannot be left in check
+  const bool whiteToMove = setup.whiteToMove;
+  const index_t us = whiteToMove ? BitboardUtil::WHITE : BitboardUtil::BLACK;
+  if (isKingAttacked(kings[us ^ 1U], us, pieceBoards, teamBoards, kings[us]))
+  {
+    return false;
+  }
+
+  // Castling rights, each needs its king and rook at home
+  for (index_t id = 0; id < CastlingIndexes.size(); id++)
+  {
+    const index_t team = id / 2U;
+    const bitboard_t rooks = pieceBoards[ROOK] & teamBoards[team];
+    if ((setup.castlingRights & BB(id)) != 0 &&
+        (kings[team] != CastlingKings[id] ||
+         (rooks & BB(CastlingRooks[id])) == 0))
+    {
+      return false;
+    }
+  }
+
+  // En passant, the pawn that double pushed must be in front of the square.
+  // The square is only kept when a pawn stands next to it, as doMove does.
+  const square_t epSquare = setup.enPassant;
+  if (epSquare == SQ_NONE)
+  {
+    return true;
+  }
+  const bitboard_t epTargets =
+      whiteToMove ? BitboardUtil::Rank3 : BitboardUtil::Rank6;
+  if (epSquare >= SQ_COUNT || (BB(epSquare) & epTargets) == 0)
+  {
+    return false;
+  }
+  const auto pushed =
+      static_cast<square_t>(whiteToMove ? epSquare + 8 : epSquare - 8);
+  if (setup.board[epSquare] != NO_PIECE ||
+      (pieceBoards[PAWN] & teamBoards[us ^ 1U] & BB(pushed)) == 0)
+  {
+    return false;
+  }
+  const bitboard_t epRank =
+      whiteToMove ? BitboardUtil::Rank4 : BitboardUtil::Rank5;
+  if ((pieceBoards[PAWN] & teamBoards[us] & epRank) == 0)
+  {
+    setup.enPassant = SQ_NONE;
+  }
+  return true;
+}
+
+void Position::setUp(const Setup &setup, const bitboard_t pieceKey,
+                     StateInfo &st)
 {
-  std::memset(this, 0, sizeof(Position));
+  std::copy(std::begin(setup.board), std::end(setup.board), m_board);
+  std::copy(setup.pieceBoards, setup.pieceBoards + NUM_TYPES, m_pieceBoards);
+  std::copy(std::begin(setup.teamBoards), std::end(setup.teamBoards),
+            m_teamBoards);
+  std::copy(std::begin(setup.kings), std::end(setup.kings), m_kings);
+  m_whiteToMove = setup.whiteToMove;
+  // Some writers count the first move as zero
+  m_ply = static_cast<std::uint16_t>(
+      2 * (std::max<std::uint16_t>(setup.fullMove, 1) - 1) +
+      (setup.whiteToMove ? 0 : 1));
+
+  // The root state is never taken back, its delta is left as it is
+  st.castlingRights = setup.castlingRights;
+  st.enPassant = setup.enPassant;
+  st.capturedPiece = NO_PIECE;
+  st.rule50 = setup.rule50;
+  st.materialScore = 0;
+  st.materialValue = 0;
+  st.prevSt = nullptr;
   m_st = &st;
-  std::memset(m_st, 0, sizeof(StateInfo));
+  bitboard_t key = pieceKey ^ Zobrist::KEYS.castling[setup.castlingRights];
+  if (setup.enPassant != SQ_NONE)
+  {
+    key ^= Zobrist::KEYS.enPassant[BitboardUtil::fileOf(setup.enPassant)];
+  }
+  m_st->hashKey = m_whiteToMove ? key : key ^ Zobrist::KEYS.blackToMove;
+  if (m_whiteToMove)
+  {
+    updateCheckInfo<Side::WHITE>();
+  }
+  else
+  {
+    updateCheckInfo<Side::BLACK>();
+  }
+}
 
-  std::istringstream stream(fen);
-  stream >> std::noskipws;
+bool Position::fenInit(const std::string_view fen, StateInfo &st)
+{
+  // The board is read with one table lookup per character and no branch on
+  // what the character is: it stores its code, the squares it covers are
+  // skipped and a slash has to close a rank of exactly eight squares. Squares
+  // past the board wrap around, such a fen ends on the wrong square and is
+  // rejected anyway.
+  alignas(16) std::uint8_t codes[SQ_COUNT] = {};
+  constexpr std::size_t RANK_SIZE = BitboardUtil::BOARD_DIMMENSION;
+  std::size_t pos = 0;
+  while (pos < fen.size() && isSpace(fen[pos]))
+  {
+    pos++;
+  }
+  std::size_t square = 0;
+  std::size_t ranks = 0; // Closed by a slash
+  bool valid = true;
+  for (; pos < fen.size() && !isSpace(fen[pos]); pos++)
+  {
+    const FenSquare code = FenSquares[static_cast<unsigned char>(fen[pos])];
+    codes[square & (SQ_COUNT - 1U)] = code.code;
+    ranks += code.slash ? 1 : 0;
+    valid &= code.valid && (!code.slash || square == ranks * RANK_SIZE);
+    square += code.advance;
+  }
+  if (!valid || square != SQ_COUNT || ranks != RANK_SIZE - 1)
+  {
+    return false;
+  }
+  Setup setup;
+  splitCodes(codes, setup);
 
-  char token = '0';
-  square_t square = 0;
+  const std::string_view side = nextField(fen, pos);
+  if (side != "w" && side != "b")
+  {
+    return false;
+  }
+  setup.whiteToMove = side == "w";
 
-  while ((stream >> token) && (std::isspace(token) == 0))
+  const std::string_view castling = nextField(fen, pos);
+  setup.castlingRights = 0;
+  if (castling != "-")
   {
-    if (std::isdigit(token) != 0)
+    bool unique = !castling.empty();
+    for (const char token : castling)
     {
-      square += (token - '0');
+      const std::uint8_t right =
+          CastlingBits[static_cast<unsigned char>(token)];
+      unique &= right != 0 && (setup.castlingRights & right) == 0;
+      setup.castlingRights |= right;
     }
-    else if (token == '/')
+    if (!unique)
     {
+      return false;
     }
-    else if (auto id = PieceIndexes.find(token); id != std::string::npos)
+  }
+
+  const std::string_view epField = nextField(fen, pos);
+  setup.enPassant = SQ_NONE;
+  if (epField != "-")
+  {
+    if (epField.size() != 2 || epField[0] < 'a' || epField[0] > 'h' ||
+        epField[1] < '1' || epField[1] > '8')
     {
-      placePiece(PieceType((id % 7U)), square, id / 7U);
+      return false;
+    }
+    setup.enPassant = GUI::makeSquare(epField[0], epField[1]);
+  }
 
-      square++;
+  // Clocks, both optional
+  setup.rule50 = 0;
+  setup.fullMove = 1;
+  if (const std::string_view clock = nextField(fen, pos);
+      !clock.empty() && !parseClock(clock, setup.rule50))
+  {
+    return false;
+  }
+  if (const std::string_view clock = nextField(fen, pos);
+      !clock.empty() && !parseClock(clock, setup.fullMove))
+  {
+    return false;
+  }
+  if (!nextField(fen, pos).empty() || !checkSetup(setup))
+  {
+    return false;
+  }
+  bitboard_t key = 0;
+  for (bitboard_t pieces = setup.pieceBoards[ALL_PIECES]; pieces != 0;
+       pieces &= pieces - 1)
+  {
+    const square_t occupied = BitboardUtil::bitScan(pieces);
+    key ^= Zobrist::KEYS.pieces[codes[occupied] / BLACK_CODE]
+                               [codes[occupied] % BLACK_CODE][occupied];
+  }
+  setUp(setup, key, st);
+  return true;
+}
+
+PackedPosition Position::encode() const
+{
+  PackedPosition packed{};
+  packed.occupancy = m_pieceBoards[ALL_PIECES];
+  std::size_t index = 0;
+  for (bitboard_t pieces = packed.occupancy; pieces != 0;
+       pieces &= pieces - 1, index++)
+  {
+    const square_t square = BitboardUtil::bitScan(pieces);
+    const bool black = (m_teamBoards[BitboardUtil::BLACK] & BB(square)) != 0;
+    const auto code =
+        static_cast<unsigned>(m_board[square] + (black ? BLACK_CODE : 0));
+    packed.pieces[index / 2] |=
+        static_cast<std::uint8_t>(code << (index % 2 * 4));
+  }
+  packed.flags = static_cast<std::uint8_t>((m_whiteToMove ? 0U : 1U) |
+                                           m_st->castlingRights << 1U);
+  packed.enPassant = m_st->enPassant;
+  packed.rule50 = m_st->rule50;
+  packed.fullMove = static_cast<std::uint16_t>(1 + m_ply / 2);
+  return packed;
+}
+
+bool Position::decode(const PackedPosition &packed, StateInfo &st)
+{
+  // Two codes per byte cover 32 pieces, the most a legal position has
+  const index_t count = BitboardUtil::bitCount(packed.occupancy);
+  if (count > 2 * packed.pieces.size() || packed.flags >= 1U << 5U)
+  {
+    return false;
+  }
+  // The codes are spread to a byte each in list order, every listed piece
+  // needs a type from pawn to king
+  alignas(16) std::uint8_t listedCodes[2 * sizeof(PackedPosition::pieces)];
+#if defined(__x86_64__) || defined(_M_X64)
+  const __m128i bytes = _mm_loadu_si128(
+      reinterpret_cast<const __m128i *>(packed.pieces.data()));
+  const __m128i nibble = _mm_set1_epi8(0xF);
+  const __m128i low = _mm_and_si128(bytes, nibble);
+  const __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble);
+  const __m128i listed[2] = {_mm_unpacklo_epi8(low, high),
+                             _mm_unpackhi_epi8(low, high)};
+  std::uint64_t invalid = 0;
+  for (std::size_t half = 0; half < 2; half++)
+  {
+    const __m128i types =
+        _mm_and_si128(listed[half], _mm_set1_epi8(BLACK_CODE - 1));
+    const __m128i bad =
+        _mm_or_si128(_mm_cmpeq_epi8(types, _mm_setzero_si128()),
+                     _mm_cmpgt_epi8(types, _mm_set1_epi8(KING)));
+    invalid |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(
+                   _mm_movemask_epi8(bad)))
+               << (half * 16);
+  }
+  if ((invalid & ((std::uint64_t{1} << count) - 1)) != 0)
+  {
+    return false;
+  }
+  _mm_store_si128(reinterpret_cast<__m128i *>(listedCodes), listed[0]);
+  _mm_store_si128(reinterpret_cast<__m128i *>(listedCodes) + 1, listed[1]);
+#else
+  for (std::size_t index = 0; index < count; index++)
+  {
+    const auto code = static_cast<std::uint8_t>(
+        packed.pieces[index / 2] >> (index % 2 * 4) & 0xFU);
+    const unsigned type = code % BLACK_CODE;
+    if (type == NO_PIECE || type > KING)
+    {
+      return false;
     }
+    listedCodes[index] = code;
+  }
+#endif
+  alignas(16) std::uint8_t codes[SQ_COUNT] = {};
+  const std::uint8_t *code = listedCodes;
+  bitboard_t key = 0;
+  for (bitboard_t pieces = packed.occupancy; pieces != 0; pieces &= pieces - 1)
+  {
+    const square_t square = BitboardUtil::bitScan(pieces);
+    codes[square] = *code;
+    key ^= Zobrist::KEYS.pieces[*code / BLACK_CODE][*code % BLACK_CODE][square];
+    code++;
   }
-  assert(square == 64);
 
-  // Side to move
-  stream >> token;
-  m_whiteToMove = token == 'w';
-  stream >> token; // Remove space
+  Setup setup;
+  splitCodes(codes, setup);
+  setup.whiteToMove = (packed.flags & 1U) == 0;
+  setup.castlingRights = static_cast<std::uint8_t>(packed.flags >> 1U);
+  setup.enPassant = packed.enPassant;
+  setup.rule50 = packed.rule50;
+  setup.fullMove = packed.fullMove;
+  if (!checkSetup(setup))
+  {
+    return false;
+  }
+  setUp(setup, key, st);
+  return true;
+}
 
-  // Castling rights
-  while ((stream >> token) && (std::isspace(token) == 0))
+char *Position::writeFen(char *buffer) const
+{
+  for (int rank = 0; rank < BitboardUtil::BOARD_DIMMENSION; rank++)
   {
-    if (auto id = CastlingIndexes.find(token); id != std::string::npos)
+    if (rank != 0)
+    {
+      *buffer++ = '/';
+    }
+    char empty = '0';
+    for (int file = 0; file < BitboardUtil::BOARD_DIMMENSION; file++)
+    {
+      const auto square =
+          static_cast<square_t>(rank * BitboardUtil::BOARD_DIMMENSION + file);
+      if (m_board[square] == NO_PIECE)
+      {
+        empty++;
+        continue;
+      }
+      if (empty != '0')
+      {
+        *buffer++ = empty;
+        empty = '0';
+      }
+      const bool black =
+          (m_teamBoards[BitboardUtil::BLACK] & BB(square)) != 0;
+      *buffer++ = PieceIndexes[m_board[square] + (black ? 7U : 0U)];
+    }
+    if (empty != '0')
     {
-      m_st->castlingRights |= BB(id);
+      *buffer++ = empty;
     }
   }
 
-  char epCol, epRow;
-  if ((stream >> epCol) && (epCol >= 'a' && epCol <= 'h') &&
-      (stream >> epRow) && (m_whiteToMove ? '6' : '3') == epRow)
+  *buffer++ = ' ';
+  *buffer++ = m_whiteToMove ? 'w' : 'b';
+  *buffer++ = ' ';
+  if (m_st->castlingRights == 0)
   {
-    m_st->enPassant = GUI::makeSquare(epCol, epRow);
+    *buffer++ = '-';
   }
-  if (m_st->enPassant == 0)
+  for (std::size_t id = 0; id < CastlingIndexes.size(); id++)
   {
-    m_st->enPassant = SQ_NONE;
+    if ((m_st->castlingRights & BB(id)) != 0)
+    {
+      *buffer++ = CastlingIndexes[id];
+    }
+  }
+  *buffer++ = ' ';
+  if (m_st->enPassant == SQ_NONE)
+  {
+    *buffer++ = '-';
   }
+  else
+  {
+    *buffer++ = static_cast<char>('a' + BitboardUtil::fileOf(m_st->enPassant));
+    *buffer++ = static_cast<char>('8' - (m_st->enPassant >> 3U));
+  }
+  *buffer++ = ' ';
+  buffer = std::to_chars(buffer, buffer + 5, m_st->rule50).ptr;
+  *buffer++ = ' ';
+  return std::to_chars(buffer, buffer + 5, 1 + m_ply / 2).ptr;
+}
+
+void Position::copyFrom(const Position &other, StateInfo &st)
+{
+  st = *other.m_st;
+  st.prevSt = nullptr;
+  m_st = &st;
+
+  std::copy(std::begin(other.m_kings), std::end(other.m_kings), m_kings);
+  std::copy(std::begin(other.m_pieceBoards), std::end(other.m_pieceBoards),
+            m_pieceBoards);
+  std::copy(std::begin(other.m_teamBoards), std::end(other.m_teamBoards),
+            m_teamBoards);
+  std::copy(std::begin(other.m_board), std::end(other.m_board), m_board);
+  m_whiteToMove = other.m_whiteToMove;
+  m_ply = other.m_ply;
 }
 
 void Position::printPieces(const std::string &fen) const
@@ -400,7 +1364,22 @@ void Position::printState() const
   std::cout << "Checkers: " << static_cast<int>(m_st->checkers) << "\n";
 }
 
-template bool Position::isSpecialEnPassantKingPin<Side::WHITE>(
-    const bitboard_t epPawns, const BitboardUtil::Masks *masks) const;
-template bool Position::isSpecialEnPassantKingPin<Side::BLACK>(
-    const bitboard_t epPawns, const BitboardUtil::Masks *masks) const;
\ No newline at end of file
+template void Position::doMove<Side::WHITE>(Move move, StateInfo &newSt);
+template void Position::doMove<Side::BLACK>(Move move, StateInfo &newSt);
+
+#define INSTANTIATE_KIND(s, kind)                                              \
+  template void Position::doMove<s, kind>(Move move, StateInfo & newSt);       \
+  template void Position::undoMove<s, kind>(Move move);
+#define INSTANTIATE_SIDE(s)                                                    \
+  INSTANTIATE_KIND(s, MoveKind::QUIET)                                         \
+  INSTANTIATE_KIND(s, MoveKind::CAPTURE)                                       \
+  INSTANTIATE_KIND(s, MoveKind::DOUBLE_PUSH)                                   \
+  INSTANTIATE_KIND(s, MoveKind::EN_PASSANT)                                    \
+  INSTANTIATE_KIND(s, MoveKind::CASTLE)                                        \
+  INSTANTIATE_KIND(s, MoveKind::PROMOTION)
+
+INSTANTIATE_SIDE(Side::WHITE)
+INSTANTIATE_SIDE(Side::BLACK)
+
+#undef INSTANTIATE_SIDE
+#undef INSTANTIATE_KIND
@@ -1,77 +1,34 @@
 #include "zobristHash.h"
+#include "bitboardUtil.h"
+#include "position.h"
+#include "types.h"
 
-#include "random"
-/*
-void ZobristHash::initHash()
-{
-  std::random_device os_seed;
-  const uint32_t seed = os_seed();
-  std::mt19937 generator(seed);
-  std::uniform_int_distribution<bitboard_t> distribute(0, UINT64_MAX);
+namespace Zobrist {
 
-  // Init piece hash
-  for (auto &hashPerPiece : pieceHash)
-  {
-    for (std::size_t j = 0; j < BOARD_DIMMENSION * BOARD_DIMMENSION; j++)
-    {
-      hashPerPiece[j] = distribute(generator);
-    }
-  }
-  // Init king hash
-  for (std::size_t i = 0; i < 2; i++)
-  {
-    for (std::size_t j = 0; j < BOARD_DIMMENSION * BOARD_DIMMENSION; j++)
-    {
-      kingHash[i][j] = distribute(generator);
-    }
-  }
-  // Init ep hash
-  for (std::size_t i = 0; i < 8; i++)
-  {
-    epHash[i] = distribute(generator);
-  }
-  // Castle hash and move hash
-  for (std::size_t i = 0; i < 16; i++)
-  {
-    castleHash[i] = distribute(generator);
-  }
-
-  whiteToMoveHash = distribute(generator);
-  moveHash = distribute(generator);
-}
-
-bitboard_t ZobristHash::hashPosition(const Position &pos)
+bitboard_t hashPosition(const Position &pos)
 {
-  bitboard_t posHash = 0ULL;
+  bitboard_t key = 0;
+  const bitboard_t blackPieces = pos.pieces_s<Side::BLACK>();
 
-  if (pos.whiteToMove)
+  for (bitboard_t pieces = pos.pieces<ALL_PIECES>(); pieces != 0;
+       pieces &= pieces - 1)
   {
-    posHash ^= whiteToMoveHash;
+    const square_t square = BitboardUtil::bitScan(pieces);
+    const index_t team = (blackPieces & BB(square)) != 0 ? BitboardUtil::BLACK
+                                                         : BitboardUtil::WHITE;
+    key ^= KEYS.pieces[team][pos.pieceOn(square)][square];
   }
 
-  for (int i = 0; i < 10; ++i)
+  key ^= KEYS.castling[pos.st()->castlingRights];
+  if (pos.st()->enPassant != SQ_NONE)
   {
-    bitboard_t pieces = pos.pieceBoards[i];
-    while (pieces)
-    {
-      const auto nextSquare = bitScan(pieces);
-      posHash ^= pieceHash[i][nextSquare];
-      pieces &= pieces - 1;
-    }
+    key ^= KEYS.enPassant[BitboardUtil::fileOf(pos.st()->enPassant)];
   }
-
-  posHash ^= kingHash[0][pos.kings[0]];
-  posHash ^= kingHash[1][pos.kings[1]];
-
-  posHash ^= castleHash[pos.st.castlingRights];
-
-  if (pos.st.enPassant != 0U)
+  if (!pos.isWhiteToMove())
   {
-    const uint8_t file = pos.st.enPassant & 7;
-    posHash ^= epHash[file];
+    key ^= KEYS.blackToMove;
   }
-  posHash ^= moveHash * pos.ply;
-
-  return posHash;
+  return key;
 }
-*/
\ No newline at end of file
+
+} // namespace Zobrist
@@ -3,15 +3,359 @@
 #include <gtest/gtest.h>
 
 #include "Engine.h"
+#include "GUI.h"
+#include "attackFill.h"
+#include "attackRays.h"
+#include "attacks.h"
+#include "compactPosition.h"
+#include "moveOrdering.h"
+#include "moveSerialize.h"
+#include "packedFile.h"
+#include "zobristHash.h"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <vector>
 
 namespace ExplorerChessTest {
+namespace {
+/// @brief Kiwipete and perft positions 3, 4 and 5, the trees the node
+/// checks below walk
+constexpr std::array<const char *, 4> TREE_FENS = {
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8"};
+
+/// @brief Walks the move tree down to the depth and runs the check in every
+/// node, stops at the first node failing it
+template <class Check>
+bool forEachNode(Position &pos, const int depth, const Check &check)
+{
+  if (!check(pos))
+  {
+    return false;
+  }
+  if (depth <= 1)
+  {
+    return true;
+  }
+  StateInfo st;
+  for (const auto move : MoveGen::MoveList<MoveFilter::ALL>(pos))
+  {
+    pos.doMove(move, st);
+    const bool valid = forEachNode(pos, depth - 1, check);
+    pos.undoMove(move);
+    if (!valid)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief Runs the check in every node of the trees of the shared fens and
+/// of the extra fens
+template <class Check>
+void expectOnTree(const int depth, const Check &check,
+                  const std::initializer_list<const char *> extraFens = {})
+{
+  std::vector<const char *> fens(TREE_FENS.begin(), TREE_FENS.end());
+  fens.insert(fens.end(), extraFens);
+  for (const auto *fen : fens)
+  {
+    Position pos;
+    StateInfo st;
+    ASSERT_TRUE(pos.fenInit(fen, st)) << fen;
+    EXPECT_TRUE(forEachNode(pos, depth, check)) << fen;
+  }
+}
+
+/// @brief Compares givesCheck of every move with the checkers found after
+/// making it
+bool givesCheckMatchesMakeMove(Position &pos)
+{
+  StateInfo st;
+  for (const auto move : MoveGen::MoveList<MoveFilter::ALL>(pos))
+  {
+    const bool checks = pos.givesCheck(move);
+    pos.doMove(move, st);
+    const bool valid = checks == (pos.checkers() != 0);
+    pos.undoMove(move);
+    if (!valid)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief Tries every 16 bit move, the ones passing isPseudoLegal and
+/// isLegal have to be exactly the generated moves
+bool legalityMatchesMoveGen(Position &pos)
+{
+  std::vector<bool> generated(1U << 16U);
+  for (const auto move : MoveGen::MoveList<MoveFilter::ALL>(pos))
+  {
+    generated[move.getData()] = true;
+  }
+  for (std::uint32_t data = 0; data < generated.size(); data++)
+  {
+    const Move move(static_cast<move_t>(data));
+    if ((pos.isPseudoLegal(move) && pos.isLegal(move)) != generated[data])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief The legal moves of a position in check, found without the move
+/// generator: every pseudo legal move is made and kept when the king is safe
+/// afterwards. Castling is never an evasion.
+std::vector<move_t> evasionsByMakeAndTest(Position &pos)
+{
+  const bool white = pos.isWhiteToMove();
+  std::vector<move_t> evasions;
+  StateInfo st;
+  for (std::uint32_t data = 0; data < (1U << 16U); data++)
+  {
+    const Move move(static_cast<move_t>(data));
+    if (!pos.isPseudoLegal(move) || move.getFlags() == CASTLE)
+    {
+      continue;
+    }
+    pos.doMove(move, st);
+    const square_t king = white ? pos.kingSquare<Side::WHITE>()
+                                : pos.kingSquare<Side::BLACK>();
+    const bitboard_t enemies = white ? pos.pieces_s<Side::BLACK>()
+                                     : pos.pieces_s<Side::WHITE>();
+    if ((pos.attackOn<SliderBackend::PORTABLE>(king,
+                                               pos.pieces<ALL_PIECES>()) &
+         enemies) == 0)
+    {
+      evasions.push_back(move.getData());
+    }
+    pos.undoMove(move);
+  }
+  return evasions;
+}
+
+/// @brief Everything undoMove has to put back, in comparable form
+std::vector<bitboard_t> boardSnapshot(const Position &pos)
+{
+  std::vector<bitboard_t> snapshot = {
+      pos.pieces<ALL_PIECES>(),       pos.pieces<PAWN>(),
+      pos.pieces<KNIGHT>(),           pos.pieces<BISHOP>(),
+      pos.pieces<ROOK>(),             pos.pieces<QUEEN>(),
+      pos.pieces<KING>(),             pos.pieces_s<Side::WHITE>(),
+      pos.pieces_s<Side::BLACK>(),    pos.kingSquare<Side::WHITE>(),
+      pos.kingSquare<Side::BLACK>(),  pos.st()->hashKey};
+  for (square_t square = 0; square < SQ_COUNT; square++)
+  {
+    snapshot.push_back(pos.pieceOn(square));
+  }
+  return snapshot;
+}
+
+/// @brief The parts of a position movegen and perft read, for both layouts
+template <class Pos> std::vector<bitboard_t> queriedState(const Pos &pos)
+{
+  return {pos.template pieces<ALL_PIECES>(),
+          pos.template pieces<Side::WHITE, PAWN>(),
+          pos.template pieces<Side::BLACK, PAWN>(),
+          pos.template pieces<KNIGHT>(),
+          pos.template pieces<BISHOP>(),
+          pos.template pieces<ROOK>(),
+          pos.template pieces<QUEEN>(),
+          pos.template pieces<Side::WHITE, ROOK, QUEEN>(),
+          pos.template pieces<Side::BLACK, BISHOP, QUEEN>(),
+          pos.template pieces_s<Side::WHITE>(),
+          pos.template kingSquare<Side::WHITE>(),
+          pos.template kingSquare<Side::BLACK>(),
+          pos.template castleRights<Side::WHITE>(),
+          pos.template castleRights<Side::BLACK>(),
+          pos.enPassant(),
+          pos.checkers(),
+          pos.pinnedMask(),
+          pos.blockForKing(),
+          pos.hashKey(),
+          pos.isWhiteToMove()};
+}
+
+/// @brief Checks that the captures and the quiets split the legal moves, with
+/// every promotion among the captures
+bool filterSplitHolds(Position &pos)
+{
+  const MoveGen::MoveList<MoveFilter::ALL> moveList(pos);
+  const MoveGen::MoveList<MoveFilter::CAPTURES> captures(pos);
+  const MoveGen::MoveList<MoveFilter::QUIETS> quiets(pos);
+  if (MoveGen::count<MoveFilter::CAPTURES>(pos) != captures.size() ||
+      MoveGen::count<MoveFilter::QUIETS>(pos) != quiets.size())
+  {
+    return false;
+  }
+
+  std::vector<move_t> all;
+  std::vector<move_t> split;
+  for (const auto move : moveList)
+  {
+    all.push_back(move.getData());
+  }
+  for (const auto move : captures)
+  {
+    const bool isCapture = pos.pieceOn(move.getTo()) != NO_PIECE ||
+                           move.getFlags() == EN_PASSANT ||
+                           move.getFlags() == PROMOTION;
+    if (!isCapture)
+    {
+      return false;
+    }
+    split.push_back(move.getData());
+  }
+  for (const auto move : quiets)
+  {
+    const bool isQuiet = pos.pieceOn(move.getTo()) == NO_PIECE &&
+                         move.getFlags() != EN_PASSANT &&
+                         move.getFlags() != PROMOTION;
+    if (!isQuiet)
+    {
+      return false;
+    }
+    split.push_back(move.getData());
+  }
+  std::sort(all.begin(), all.end());
+  std::sort(split.begin(), split.end());
+  return all == split;
+}
+
+/// @brief Checks that the move picker hands out every legal move exactly once
+/// with the hash move first and killers ahead of the other quiets
+bool pickerHandsOutEveryMove(Position &pos)
+{
+  const MoveGen::MoveList<MoveFilter::ALL> moveList(pos);
+  if (moveList.size() == 0)
+  {
+    return true;
+  }
+  const Move ttMove = *(moveList.end() - 1);
+  Move killers[MoveOrder::NUM_KILLERS] = {*moveList.begin(),
+                                          Move::make(SQ_A1, SQ_H8)};
+
+  std::vector<move_t> picked;
+  MovePicker picker(pos, ttMove, killers);
+  for (Move move = picker.next(); move.getData() != 0; move = picker.next())
+  {
+    picked.push_back(move.getData());
+  }
+  if (picked.front() != ttMove.getData())
+  {
+    return false;
+  }
+  // The killer is handed out ahead of every other quiet move
+  const auto isQuiet = [&](const move_t data) {
+    const Move move(data);
+    return pos.pieceOn(move.getTo()) == NO_PIECE &&
+           move.getFlags() != EN_PASSANT && move.getFlags() != PROMOTION;
+  };
+  if (isQuiet(killers[0].getData()) &&
+      killers[0].getData() != ttMove.getData())
+  {
+    const auto killer =
+        std::find(picked.begin(), picked.end(), killers[0].getData());
+    if (std::any_of(picked.begin() + 1, killer, isQuiet))
+    {
+      return false;
+    }
+  }
+
+  std::vector<move_t> generated;
+  for (const auto move : moveList)
+  {
+    generated.push_back(move.getData());
+  }
+  std::sort(picked.begin(), picked.end());
+  std::sort(generated.begin(), generated.end());
+  return picked == generated;
+}
+
+bitboard_t keyAfterMoves(const std::string &fen,
+                         std::initializer_list<std::string> moves)
+{
+  Position pos;
+  StateInfo states[8];
+  pos.fenInit(fen, states[0]);
+  StateInfo *st = &states[1];
+  for (const auto &notation : moves)
+  {
+    pos.doMove(MoveGen::MoveList<MoveFilter::ALL>(pos).find(
+                   GUI::parseMove(notation)),
+               *st++);
+  }
+  return pos.st()->hashKey;
+}
+
+/// @brief Slider attacks found by walking the board one square at a time
+bitboard_t slidingAttackReference(const PieceType pt,
+                                  const bitboard_t occupancy,
+                                  const square_t square)
+{
+  constexpr int bishopDirs[4][2] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+  constexpr int rookDirs[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+  const auto &dirs = pt == BISHOP ? bishopDirs : rookDirs;
+
+  bitboard_t attack = 0;
+  for (const auto &[fileStep, rankStep] : dirs)
+  {
+    int file = square % 8 + fileStep;
+    int rank = square / 8 + rankStep;
+    for (; file >= 0 && file < 8 && rank >= 0 && rank < 8;
+         file += fileStep, rank += rankStep)
+    {
+      const bitboard_t target = BB(static_cast<square_t>(rank * 8 + file));
+      attack |= target;
+      if (occupancy & target)
+      {
+        break;
+      }
+    }
+  }
+  return attack;
+}
+
+template <SliderBackend b>
+bitboard_t backendAttacks(const PieceType pt, const bitboard_t occupancy,
+                          const square_t square)
+{
+  return pt == BISHOP ? ATTACKS::sliderAttacks<BISHOP, b>(occupancy, square)
+                      : ATTACKS::sliderAttacks<ROOK, b>(occupancy, square);
+}
+
+/// @brief Puts the serializer kernel back when a test leaves, also on a
+/// failed assertion
+class KernelRestorer final
+{
+public:
+  KernelRestorer() : m_kernel(SERIALIZE::kernel()) {}
+  ~KernelRestorer() { SERIALIZE::setKernel(m_kernel); }
+
+  KernelRestorer(const KernelRestorer &) = delete;
+  KernelRestorer &operator=(const KernelRestorer &) = delete;
+
+private:
+  SERIALIZE::Kernel m_kernel;
+};
+} // namespace
 
 bool testPos(const enginePtr &engine, std::string &&fen, const bitboard_t count,
-             const int depth)
+             const int depth, const int threads, const std::size_t hashMB,
+             const Perft::PositionMode mode)
 {
   engine->initFen(fen);
 
-  return engine->runPerft(depth) == count;
+  return engine->runPerft(depth, threads, hashMB, mode) == count;
 }
 
 // clang-format off
@@ -74,6 +418,585 @@ TEST_F(PerftSuite, CastleRightsAllowedNonePossible)
                       2010267707ULL, 6));
 }
 
+TEST_F(PerftSuite, KiwipeteEverySliderBackend)
+{
+  for (const auto backend : SLIDER_BACKENDS)
+  {
+    if (!ATTACKS::setBackend(backend))
+    {
+      continue;
+    }
+    EXPECT_TRUE(testPos(
+        m_engine,
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -",
+        4085603, 4))
+        << ATTACKS::backendName(backend);
+  }
+  ATTACKS::setBackend(ATTACKS::detectBackend());
+}
+
+TEST_F(PerftSuite, CopyMakePositions)
+{
+  constexpr auto copyMake = Perft::PositionMode::COPY_MAKE;
+  EXPECT_TRUE(testPos(
+      m_engine,
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -",
+      4085603, 4, 1, 0, copyMake));
+  EXPECT_TRUE(testPos(m_engine, "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - ",
+                      11030083ULL, 6, 1, 0, copyMake));
+  EXPECT_TRUE(testPos(
+      m_engine,
+      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+      422333, 4, 1, 0, copyMake));
+  EXPECT_TRUE(testPos(
+      m_engine, "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+      2103487, 4, 1, 0, copyMake));
+  // Workers and the shared table see the same keys as make/unmake
+  EXPECT_TRUE(testPos(
+      m_engine,
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -",
+      193690690ULL, 5, 2, 16, copyMake));
+}
+
+TEST_F(PerftSuite, ParallelKiwipete)
+{
+  EXPECT_TRUE(testPos(
+      m_engine,
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -",
+      193690690ULL, 5, 4));
+}
+
+TEST_F(PerftSuite, ParallelPromotionPins)
+{
+  EXPECT_TRUE(testPos(
+      m_engine, "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+      89941194ULL, 5, 3));
+}
+
+TEST_F(PerftSuite, HashedKiwipete)
+{
+  EXPECT_TRUE(testPos(
+      m_engine,
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -",
+      193690690ULL, 5, 1, 16));
+}
+
+TEST_F(PerftSuite, HashedParallelCastleRightsAllowedNonePossible)
+{
+  EXPECT_TRUE(testPos(m_engine, "r3k2r/8/3Q4/8/8/5q2/8/R3K2R b KQkq - 0 1",
+                      2010267707ULL, 6, 4, 64));
+}
+
+TEST_F(PositionSuite, IncrementalHashKeys)
+{
+  expectOnTree(4, [](Position &pos) {
+    return pos.st()->hashKey == Zobrist::hashPosition(pos);
+  });
+}
+
+TEST_F(PositionSuite, UndoDeltaRestoresBoard)
+{
+  expectOnTree(3, [](Position &pos) {
+    const std::vector<bitboard_t> before = boardSnapshot(pos);
+    StateInfo st;
+    for (const auto move : MoveGen::MoveList<MoveFilter::ALL>(pos))
+    {
+      pos.doMove(move, st);
+      pos.undoMove(move);
+      if (boardSnapshot(pos) != before)
+      {
+        return false;
+      }
+    }
+    return true;
+  });
+}
+
+TEST_F(PositionSuite, CompactPositionFollowsPosition)
+{
+  expectOnTree(3, [](Position &pos) {
+    const CompactPosition compact(pos);
+    if (queriedState(pos) != queriedState(compact))
+    {
+      return false;
+    }
+    StateInfo st;
+    for (const auto move : MoveGen::MoveList<MoveFilter::ALL>(pos))
+    {
+      CompactPosition child = compact;
+      child.doMove(move);
+      pos.doMove(move, st);
+      const bool valid = queriedState(pos) == queriedState(child);
+      pos.undoMove(move);
+      if (!valid)
+      {
+        return false;
+      }
+    }
+    return true;
+  });
+}
+
+TEST_F(PositionSuite, CountMatchesGeneratedMoves)
+{
+  expectOnTree(4, [](Position &pos) {
+    return MoveGen::count<MoveFilter::ALL>(pos) ==
+           MoveGen::MoveList<MoveFilter::ALL>(pos).size();
+  });
+}
+
+TEST_F(PositionSuite, CapturesAndQuietsSplitAllMoves)
+{
+  expectOnTree(3, filterSplitHolds);
+}
+
+TEST_F(PositionSuite, CheckEvasionsMatchFilteredMoves)
+{
+  // The full move list in check comes from the evasion generator, it has to
+  // match make and test. The captures and quiets do not use it, the split
+  // checks them against it deeper in the tree.
+  for (const auto *fen : {"4k3/8/8/8/1b6/8/8/R3K2R w KQ - 0 1",
+                          "4k3/8/8/8/8/5n2/8/R3K2r w Q - 0 1",
+                          "3qk3/8/8/1B6/8/8/3R4/3K4 b - - 0 1",
+                          "8/8/8/2k5/3Pp3/8/8/4K3 b - d3 0 1"})
+  {
+    Position pos;
+    StateInfo st;
+    pos.fenInit(fen, st);
+    EXPECT_NE(pos.st()->checkers, 0) << fen;
+
+    std::vector<move_t> generated;
+    for (const auto move : MoveGen::MoveList<MoveFilter::ALL>(pos))
+    {
+      generated.push_back(move.getData());
+    }
+    std::vector<move_t> reference = evasionsByMakeAndTest(pos);
+    std::sort(generated.begin(), generated.end());
+    std::sort(reference.begin(), reference.end());
+    EXPECT_EQ(generated, reference) << fen;
+    EXPECT_EQ(MoveGen::count<MoveFilter::CHECK_EVASIONS>(pos),
+              reference.size())
+        << fen;
+    EXPECT_TRUE(forEachNode(pos, 3, filterSplitHolds)) << fen;
+  }
+}
+
+TEST_F(PositionSuite, MostMovesFitInMoveList)
+{
+  // The legal position with the most moves
+  Position pos;
+  StateInfo st;
+  pos.fenInit("R6R/3Q4/1Q4Q1/4Q3/2Q4Q/Q4Q2/pp1Q4/kBNN1KB1 w - - 0 1", st);
+  const MoveGen::MoveList<MoveFilter::ALL> moveList(pos);
+  EXPECT_EQ(moveList.size(), 218);
+  EXPECT_EQ(MoveGen::count<MoveFilter::ALL>(pos), 218);
+}
+
+TEST_F(PositionSuite, VectorSerializerMatchesScalar)
+{
+  if (!SERIALIZE::isSupported(SERIALIZE::Kernel::AVX512))
+  {
+    GTEST_SKIP() << "No AVX-512 VBMI2";
+  }
+  const KernelRestorer restorer;
+  for (const auto *fen :
+       {"R6R/3Q4/1Q4Q1/4Q3/2Q4Q/Q4Q2/pp1Q4/kBNN1KB1 w - - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR b KQkq - 0 1",
+        "r3k2r/8/3Q4/8/8/5q2/8/R3K2R b KQkq - 0 1"})
+  {
+    Position pos;
+    StateInfo st;
+    pos.fenInit(fen, st);
+    SERIALIZE::setKernel(SERIALIZE::Kernel::SCALAR);
+    const MoveGen::MoveList<MoveFilter::ALL> scalar(pos);
+    SERIALIZE::setKernel(SERIALIZE::Kernel::AVX512);
+    const MoveGen::MoveList<MoveFilter::ALL> vector(pos);
+    ASSERT_EQ(scalar.size(), vector.size()) << fen;
+    for (index_t i = 0; i < scalar.size(); i++)
+    {
+      EXPECT_EQ(scalar.begin()[i].getData(), vector.begin()[i].getData())
+          << fen;
+    }
+  }
+}
+
+TEST_F(PositionSuite, MovePickerHandsOutEveryMoveOnce)
+{
+  expectOnTree(3, pickerHandsOutEveryMove);
+}
+
+TEST_F(PositionSuite, StaticExchangeEvaluation)
+{
+  struct Exchange
+  {
+    const char *fen;
+    Move move;
+    int value;
+  };
+  for (const auto &[fen, move, value] : {
+           // Defended by nobody, then x-rays on both sides
+           Exchange{"1k1r4/1pp4p/p7/4p3/8/P5P1/1PP4P/2K1R3 w - - 0 1",
+                    Move::make(SQ_E1, SQ_E5), 100},
+           Exchange{"1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1",
+                    Move::make(SQ_D3, SQ_E5), -200},
+           // Promotions, the queen on b8 falls to the king
+           Exchange{"8/1P2k3/8/8/8/8/8/4K3 w - - 0 1",
+                    Move::make<PROMOTION>(SQ_B7, SQ_B8, QUEEN), 800},
+           Exchange{"8/1P2k3/8/8/8/8/8/4K3 w - - 0 1",
+                    Move::make<PROMOTION>(SQ_B7, SQ_B8, KNIGHT), 200},
+           Exchange{"1r6/P1k5/8/8/8/8/8/4K3 w - - 0 1",
+                    Move::make<PROMOTION>(SQ_A7, SQ_B8, QUEEN), 400},
+           // The rook on d1 backs up through the pawn taken en passant
+           Exchange{"3rk3/8/8/3pP3/8/8/8/3RK3 w - d6 0 2",
+                    Move::make<EN_PASSANT>(SQ_E5, SQ_D6), 100},
+           // The king cannot take back a defended piece
+           Exchange{"4k3/4r3/8/7b/8/8/4p3/3QK3 w - - 0 1",
+                    Move::make(SQ_D1, SQ_E2), -800},
+           Exchange{"r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1",
+                    Move::make<CASTLE>(SQ_E1, SQ_G1), 0}})
+  {
+    Position pos;
+    StateInfo st;
+    ASSERT_TRUE(pos.fenInit(fen, st)) << fen;
+    EXPECT_TRUE(pos.see(move, value)) << fen;
+    EXPECT_FALSE(pos.see(move, value + 1)) << fen;
+  }
+}
+
+TEST_F(PositionSuite, GivesCheckMatchesMakeMove)
+{
+  for (const auto backend : SLIDER_BACKENDS)
+  {
+    if (!ATTACKS::setBackend(backend))
+    {
+      continue;
+    }
+    SCOPED_TRACE(ATTACKS::backendName(backend));
+    // Castling rooks, a file opened by promoting and en passant
+    expectOnTree(3, givesCheckMatchesMakeMove,
+                 {"5k2/8/8/8/8/8/8/4K2R w K - 0 1",
+                  "2k5/8/8/8/8/8/8/R3K3 w Q - 0 1",
+                  "4k3/4P3/8/8/8/8/8/4RK2 w - - 0 1",
+                  "8/8/8/k2pP2R/8/8/8/4K3 w - d6 0 2"});
+  }
+  ATTACKS::setBackend(ATTACKS::detectBackend());
+}
+
+TEST_F(PositionSuite, LegalityMatchesMoveGen)
+{
+  for (const auto backend : SLIDER_BACKENDS)
+  {
+    if (!ATTACKS::setBackend(backend))
+    {
+      continue;
+    }
+    SCOPED_TRACE(ATTACKS::backendName(backend));
+    // En passant out of check, not out of a knight check and along a pinned
+    // rank
+    expectOnTree(2, legalityMatchesMoveGen,
+                 {"8/8/8/2k5/3Pp3/8/8/4K3 b - d3 0 1",
+                  "4k3/8/8/3pP3/8/5n2/8/4K3 w - d6 0 2",
+                  "8/8/8/K2pP2r/8/8/8/4k3 w - d6 0 2"});
+  }
+  ATTACKS::setBackend(ATTACKS::detectBackend());
+}
+
+TEST_F(PositionSuite, TranspositionsShareHashKey)
+{
+  const std::string startpos =
+      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+  EXPECT_EQ(keyAfterMoves(startpos, {"g1f3", "g8f6", "b1c3"}),
+            keyAfterMoves(startpos, {"b1c3", "g8f6", "g1f3"}));
+  EXPECT_NE(keyAfterMoves(startpos, {"g1f3", "g8f6"}),
+            keyAfterMoves(startpos, {"g1f3", "b8c6"}));
+}
+
+TEST_F(PositionSuite, FenRoundTrip)
+{
+  for (const std::string fen :
+       {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+        "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+        "rnbqkbnr/pppp1ppp/8/8/3Pp3/8/PPP1PPPP/RNBQKBNR b KQkq d3 0 2",
+        "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 b - - 57 301"})
+  {
+    Position pos;
+    StateInfo st;
+    ASSERT_TRUE(pos.fenInit(fen, st)) << fen;
+    EXPECT_EQ(GUI::getPositionFen(pos), fen);
+    EXPECT_EQ(pos.hashKey(), Zobrist::hashPosition(pos)) << fen;
+  }
+
+  // Missing clocks are the defaults and an en passant square nobody can take
+  // on is dropped, as doMove does
+  Position pos;
+  StateInfo states[4];
+  ASSERT_TRUE(
+      pos.fenInit("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8\tw - -\n", states[0]));
+  EXPECT_EQ(GUI::getPositionFen(pos),
+            "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1");
+  ASSERT_TRUE(pos.fenInit(
+      "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1",
+      states[0]));
+  EXPECT_EQ(GUI::getPositionFen(pos),
+            "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1");
+
+  // The clocks follow the moves
+  ASSERT_TRUE(pos.fenInit(
+      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", states[0]));
+  StateInfo *st = &states[1];
+  for (const auto *notation : {"e2e4", "e7e5", "g1f3"})
+  {
+    pos.doMove(MoveGen::MoveList<MoveFilter::ALL>(pos).find(
+                   GUI::parseMove(notation)),
+               *st++);
+  }
+  EXPECT_EQ(GUI::getPositionFen(pos),
+            "rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq - 1 2");
+}
+
+TEST_F(PositionSuite, FenRejectsMalformed)
+{
+  const std::string startpos =
+      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+  Position pos;
+  StateInfo st;
+  ASSERT_TRUE(pos.fenInit(startpos, st));
+  const bitboard_t key = pos.hashKey();
+
+  for (const std::string fen : {
+           "",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP w KQkq - 0 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR/8 w KQkq - 0 1",
+           "rnbqkbnr/ppppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+           "rnbqkbnr/ppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+           "rnbqkbnr/pppppppp/9/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNx w KQkq - 0 1",
+           "8888888888888888888888888888888888888888 w - - 0 1",
+           "rnbq1bnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQ - 0 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKKNR w - - 0 1",
+           "4k3/8/8/8/8/8/8/P3K3 w - - 0 1",
+           "4k3/8/8/8/8/8/8/4R1K1 w - - 0 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR x KQkq - 0 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkX - 0 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KKQkq - 0 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBN1 w KQkq - 0 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq e9 0 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq e6 0 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - x 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 99999 1",
+           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1 0"})
+  {
+    EXPECT_FALSE(pos.fenInit(fen, st)) << fen;
+    // The position is left as it was
+    EXPECT_EQ(GUI::getPositionFen(pos), startpos) << fen;
+    EXPECT_EQ(pos.hashKey(), key) << fen;
+  }
+}
+
+TEST_F(PositionSuite, PackedRoundTrip)
+{
+  const std::vector<std::string> fens = {
+      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+      "rnbqkbnr/pppp1ppp/8/8/3Pp3/8/PPP1PPPP/RNBQKBNR b KQkq d3 0 2",
+      "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 b - - 57 301"};
+  std::vector<PackedPosition> records;
+  for (const auto &fen : fens)
+  {
+    Position pos;
+    StateInfo st;
+    ASSERT_TRUE(pos.fenInit(fen, st)) << fen;
+    records.push_back(pos.encode());
+
+    Position decoded;
+    StateInfo decodedSt;
+    ASSERT_TRUE(decoded.decode(records.back(), decodedSt)) << fen;
+    EXPECT_EQ(GUI::getPositionFen(decoded), fen);
+    EXPECT_EQ(decoded.hashKey(), pos.hashKey()) << fen;
+    EXPECT_EQ(decoded.checkers(), pos.checkers()) << fen;
+  }
+
+  // Corrupt records are rejected and leave the position as it was
+  Position pos;
+  StateInfo st;
+  ASSERT_TRUE(pos.decode(records[0], st));
+  const bitboard_t key = pos.hashKey();
+  std::vector<PackedPosition> corrupt(6, records[0]);
+  corrupt[0].pieces[0] = 0x77;        // No piece type seven
+  corrupt[1].occupancy |= BB(SQ_E4); // 33 pieces
+  corrupt[2].flags = 0xFF;
+  corrupt[3].enPassant = SQ_E3;
+  corrupt[4].occupancy = ~bitboard_t{0};
+  corrupt[5].fullMove = 0xFFFF;
+  for (const auto &packed : corrupt)
+  {
+    EXPECT_FALSE(pos.decode(packed, st));
+    EXPECT_EQ(GUI::getPositionFen(pos), fens[0]);
+    EXPECT_EQ(pos.hashKey(), key);
+  }
+
+  // Through a file, read in blocks smaller than the file
+  const std::string path =
+      (std::filesystem::temp_directory_path() / "packed_round_trip.bin")
+          .string();
+  {
+    PACKED::Writer writer(path);
+    ASSERT_TRUE(writer.isOpen());
+    EXPECT_TRUE(writer.write(records));
+  }
+  {
+    // The occupancy is stored little endian whatever the host
+    std::ifstream file(path, std::ios::binary);
+    unsigned char bytes[sizeof(bitboard_t)] = {};
+    file.read(reinterpret_cast<char *>(bytes), sizeof(bytes));
+    bitboard_t occupancy = 0;
+    for (std::size_t i = 0; i < sizeof(bytes); i++)
+    {
+      occupancy |= bitboard_t{bytes[i]} << (8 * i);
+    }
+    EXPECT_EQ(occupancy, records[0].occupancy);
+  }
+  PACKED::Reader reader(path);
+  ASSERT_TRUE(reader.isOpen());
+  PackedPosition block[2];
+  std::size_t index = 0;
+  for (std::size_t read = reader.read(block); read != 0;
+       read = reader.read(block))
+  {
+    for (std::size_t i = 0; i < read; i++, index++)
+    {
+      ASSERT_TRUE(pos.decode(block[i], st));
+      EXPECT_EQ(GUI::getPositionFen(pos), fens[index]);
+    }
+  }
+  EXPECT_EQ(index, fens.size());
+  std::filesystem::remove(path);
+}
+
+TEST_F(PositionSuite, SliderAttacksMatchReference)
+{
+  bitboard_t seed = 0x9E3779B97F4A7C15ULL;
+  for (square_t square = SQ_A8; square <= SQ_H1; square++)
+  {
+    for (int i = 0; i < 256; i++)
+    {
+      // Sparse random occupancies, like the ones seen in games
+      seed ^= seed >> 12;
+      seed ^= seed << 25;
+      seed ^= seed >> 27;
+      const bitboard_t occupancy = seed & (seed >> 7) & (seed >> 13);
+      for (const PieceType pt : {BISHOP, ROOK})
+      {
+        const bitboard_t expected =
+            slidingAttackReference(pt, occupancy, square);
+        EXPECT_EQ(backendAttacks<SliderBackend::MAGIC>(pt, occupancy, square),
+                  expected);
+        EXPECT_EQ(
+            backendAttacks<SliderBackend::PORTABLE>(pt, occupancy, square),
+            expected);
+        if (ATTACKS::isSupported(SliderBackend::PEXT))
+        {
+          EXPECT_EQ(backendAttacks<SliderBackend::PEXT>(pt, occupancy, square),
+                    expected);
+          EXPECT_EQ(
+              backendAttacks<SliderBackend::PEXT_PDEP>(pt, occupancy, square),
+              expected);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(PositionSuite, LinesAndBetweenMatchReference)
+{
+  for (square_t sq1 = SQ_A8; sq1 <= SQ_H1; sq1++)
+  {
+    for (square_t sq2 = SQ_A8; sq2 <= SQ_H1; sq2++)
+    {
+      if (sq1 == sq2)
+      {
+        continue;
+      }
+      // Two sliders blocking each other see exactly the squares between them
+      const bitboard_t rookBetween =
+          slidingAttackReference(ROOK, BB(sq2), sq1) &
+          slidingAttackReference(ROOK, BB(sq1), sq2);
+      const bitboard_t bishopBetween =
+          slidingAttackReference(BISHOP, BB(sq2), sq1) &
+          slidingAttackReference(BISHOP, BB(sq1), sq2);
+      const bool rookAligned =
+          (slidingAttackReference(ROOK, 0, sq1) & BB(sq2)) != 0;
+      const bool bishopAligned =
+          (slidingAttackReference(BISHOP, 0, sq1) & BB(sq2)) != 0;
+
+      const bitboard_t line = RayConstants::lineBB(sq1, sq2);
+      EXPECT_EQ(line, RayConstants::lineBB(sq2, sq1));
+      if (rookAligned || bishopAligned)
+      {
+        const PieceType pt = rookAligned ? ROOK : BISHOP;
+        EXPECT_EQ(line, (slidingAttackReference(pt, 0, sq1) &
+                         slidingAttackReference(pt, 0, sq2)) |
+                            BB(sq1) | BB(sq2) |
+                            (rookAligned ? rookBetween : bishopBetween));
+        EXPECT_EQ(RayConstants::betweenBB(sq1, sq2),
+                  rookAligned ? rookBetween : bishopBetween);
+      }
+      else
+      {
+        EXPECT_EQ(line, 0ULL);
+        EXPECT_EQ(RayConstants::betweenBB(sq1, sq2), 0ULL);
+      }
+    }
+  }
+}
+
+TEST_F(PositionSuite, SliderFillMatchesLookups)
+{
+  bitboard_t seed = 0x2545F4914F6CDD1DULL;
+  for (int i = 0; i < 4096; i++)
+  {
+    seed ^= seed >> 12;
+    seed ^= seed << 25;
+    seed ^= seed >> 27;
+    const bitboard_t occupancy = seed & (seed >> 9);
+    const bitboard_t orthogonal = occupancy & (seed >> 21) & (seed >> 30);
+    const bitboard_t diagonal = occupancy & (seed >> 17) & (seed >> 40);
+
+    bitboard_t expectedOrthogonal = 0;
+    for (bitboard_t rooks = orthogonal; rooks != 0; rooks &= rooks - 1)
+    {
+      expectedOrthogonal |= slidingAttackReference(
+          ROOK, occupancy, BitboardUtil::bitScan(rooks));
+    }
+    bitboard_t expectedDiagonal = 0;
+    for (bitboard_t bishops = diagonal; bishops != 0; bishops &= bishops - 1)
+    {
+      expectedDiagonal |= slidingAttackReference(
+          BISHOP, occupancy, BitboardUtil::bitScan(bishops));
+    }
+
+    for (const auto kernel :
+         {FILL::Kernel::SCALAR, FILL::Kernel::AVX2, FILL::Kernel::AVX512})
+    {
+      if (!FILL::isSupported(kernel))
+      {
+        continue;
+      }
+      const FILL::SliderMaps maps =
+          FILL::sliderAttacks(kernel, orthogonal, diagonal, occupancy);
+      EXPECT_EQ(maps.orthogonal, expectedOrthogonal)
+          << FILL::kernelName(kernel);
+      EXPECT_EQ(maps.diagonal, expectedDiagonal) << FILL::kernelName(kernel);
+    }
+  }
+}
+
 } // namespace ExplorerChessTest
 
 //     // "r3k2r/8/3Q4/8/8/5q2/8/R3K2R b KQkq - 0 1", 2010267707ULL, 6));
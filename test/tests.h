@@ -9,7 +9,8 @@ namespace ExplorerChessTest {
 using enginePtr = std::unique_ptr<Engine>;
 
 bool testPos(const enginePtr &engine, std::string &&fen, bitboard_t count,
-             int depth);
+             int depth, int threads = 1, std::size_t hashMB = 0,
+             Perft::PositionMode mode = Perft::PositionMode::MAKE_UNMAKE);
 
 class PerftSuite : public testing::Test
 {
@@ -21,15 +22,15 @@ protected:
   // If the constructor and destructor are not enough for setting up
   // and cleaning up each test, you can define the following methods:
 
-  void SetUp() override
-  {
-    ATTACKS::init();
-    m_engine = std::make_unique<Engine>();
-  }
+  void SetUp() override { m_engine = std::make_unique<Engine>(); }
 
   void TearDown() override {}
 
   std::unique_ptr<Engine> m_engine;
 };
 
+class PositionSuite : public testing::Test
+{
+};
+
 } // namespace ExplorerChessTest
\ No newline at end of file